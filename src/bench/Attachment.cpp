@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	constexpr unsigned WIDE_ROWS = 20000;
+
+	// Fetches WIDE_ROWS rows of repetitive text through a second connection created with `options`.
+	// The effect of wire compression is only visible when FBCPP_BENCH_SERVER points to a server.
+	void runWideFetch(bench::State& state, const char* databaseName, const AttachmentOptions& options)
+	{
+		bench::BenchDatabase database{databaseName};
+
+		{  // scope
+			auto& attachment = database.getAttachment();
+			Transaction transaction{attachment};
+
+			Statement ddl{attachment, transaction, "create table bench_wide (id integer, payload varchar(1000))"};
+			ddl.execute(transaction);
+			transaction.commitRetaining();
+
+			Statement insert{attachment, transaction,
+				"execute block (count integer = ?) as declare i integer = 1; begin "
+				"while (i <= count) do begin insert into bench_wide values (:i, rpad('', 1000, 'firebird ')); "
+				"i = i + 1; end end"};
+			insert.setInt32(0, static_cast<std::int32_t>(WIDE_ROWS));
+			insert.execute(transaction);
+			insert.free();
+			transaction.commit();
+		}
+
+		Attachment attachment{CLIENT, database.getAttachment().getUri(), options};
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction, "select id, payload from bench_wide"};
+		std::uint64_t rowCount = 0;
+
+		while (state.keepRunning())
+		{
+			unsigned count = 0;
+
+			for (bool found = select.execute(transaction); found; found = select.fetchNext())
+			{
+				bench::doNotOptimize(select.getStringView(1));
+				++count;
+			}
+
+			if (count != WIDE_ROWS)
+				throw std::runtime_error{"Unexpected row count"};
+
+			rowCount += count;
+		}
+
+		select.free();
+		transaction.commit();
+		attachment.disconnect();
+		state.setItemsProcessed(rowCount);
+	}
+}  // namespace
+
+
+FBCPP_BENCHMARK(Attachment_wideFetch)
+{
+	runWideFetch(state, "Attachment_wideFetch", AttachmentOptions().setWireCompression(false));
+}
+
+FBCPP_BENCHMARK(Attachment_wideFetchCompressed)
+{
+	runWideFetch(state, "Attachment_wideFetchCompressed", AttachmentOptions().setWireCompression(true));
+}
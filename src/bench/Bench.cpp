@@ -0,0 +1,244 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace fbcpp::bench
+{
+	Client CLIENT{fb::fb_get_master_interface()};
+
+	std::string getTempFile(std::string_view name)
+	{
+		const char* dirEnv = std::getenv("FBCPP_BENCH_DIR");
+		const char* serverEnv = std::getenv("FBCPP_BENCH_SERVER");
+
+		const auto dir =
+			dirEnv && *dirEnv ? std::filesystem::path{dirEnv} : std::filesystem::temp_directory_path();
+		const auto prefix = serverEnv && *serverEnv ? std::string{serverEnv} + ":" : std::string{};
+
+		return prefix + (dir / ("fbcpp-bench-" + std::string{name} + ".fdb")).string();
+	}
+
+	std::vector<Benchmark>& getBenchmarks()
+	{
+		static std::vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+
+	namespace
+	{
+		struct Options final
+		{
+			std::string_view filter;
+			std::chrono::nanoseconds minTime = std::chrono::milliseconds{500};
+			bool json = false;
+		};
+
+		// One line of the report; error is set when the case threw.
+		struct Result final
+		{
+			std::string_view name;
+			std::uint64_t iterations = 0;
+			double nanosecondsPerIteration = 0;
+			double itemsPerSecond = 0;
+			std::string error;
+		};
+
+		bool parseOptions(int argc, char* argv[], Options& options)
+		{
+			for (int i = 1; i < argc; ++i)
+			{
+				const std::string_view arg{argv[i]};
+
+				if (arg.starts_with("--filter="))
+					options.filter = arg.substr(9);
+				else if (arg.starts_with("--min-time-ms="))
+				{
+					const auto value = arg.substr(14);
+					unsigned milliseconds = 0;
+					const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), milliseconds);
+
+					if (ec != std::errc{} || ptr != value.data() + value.size())
+						return false;
+
+					options.minTime = std::chrono::milliseconds{milliseconds};
+				}
+				else if (arg == "--format=json")
+					options.json = true;
+				else if (arg == "--format=console")
+					options.json = false;
+				else
+					return false;
+			}
+
+			return true;
+		}
+
+		// Doubles the iteration count until one run takes at least minTime and reports that run.
+		State run(const Benchmark& benchmark, std::chrono::nanoseconds minTime)
+		{
+			for (std::uint64_t iterations = 1;; iterations *= 2)
+			{
+				State state{iterations};
+				benchmark.function(state);
+
+				if (state.getElapsed() >= minTime || iterations >= (std::uint64_t{1} << 40))
+					return state;
+			}
+		}
+
+		void printJsonString(std::string_view value)
+		{
+			std::putchar('"');
+
+			for (const auto c : value)
+			{
+				if (c == '"' || c == '\\')
+					std::printf("\\%c", c);
+				else if (static_cast<unsigned char>(c) < 0x20)
+					std::printf("\\u%04x", static_cast<unsigned>(c));
+				else
+					std::putchar(c);
+			}
+
+			std::putchar('"');
+		}
+
+		// Same layout as Google Benchmark's JSON reporter, so its compare tools can diff two runs.
+		void printJson(const std::vector<Result>& results, const Options& options)
+		{
+			std::printf("{\n  \"context\": {\n    \"library\": \"fb-cpp\",\n    \"min_time_ms\": %lld\n  },\n",
+				static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(options.minTime).count()));
+			std::printf("  \"benchmarks\": [");
+
+			for (std::size_t i = 0; i < results.size(); ++i)
+			{
+				const auto& result = results[i];
+
+				std::printf("%s\n    {\"name\": ", i == 0 ? "" : ",");
+				printJsonString(result.name);
+
+				if (!result.error.empty())
+				{
+					std::printf(", \"error_occurred\": true, \"error_message\": ");
+					printJsonString(result.error);
+				}
+				else
+				{
+					std::printf(", \"run_type\": \"iteration\", \"iterations\": %llu, \"real_time\": %.1f, "
+								"\"time_unit\": \"ns\"",
+						static_cast<unsigned long long>(result.iterations), result.nanosecondsPerIteration);
+
+					if (result.itemsPerSecond > 0)
+						std::printf(", \"items_per_second\": %.0f", result.itemsPerSecond);
+				}
+
+				std::printf("}");
+			}
+
+			std::printf("\n  ]\n}\n");
+		}
+	}  // namespace
+}  // namespace fbcpp::bench
+
+
+int main(int argc, char* argv[])
+{
+	using namespace fbcpp::bench;
+
+	Options options;
+
+	if (!parseOptions(argc, argv, options))
+	{
+		std::fprintf(stderr,
+			"Usage: %s [--filter=<substring>] [--min-time-ms=<milliseconds>] [--format=console|json]\n", argv[0]);
+		return 1;
+	}
+
+	int result = 0;
+	std::vector<Result> results;
+
+	if (!options.json)
+		std::printf("%-48s %14s %14s %16s\n", "Benchmark", "Iterations", "ns/iter", "items/s");
+
+	for (const auto& benchmark : getBenchmarks())
+	{
+		if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string_view::npos)
+			continue;
+
+		Result& line = results.emplace_back();
+		line.name = benchmark.name;
+
+		try
+		{
+			const auto state = run(benchmark, options.minTime);
+			const auto nanoseconds = static_cast<double>(state.getElapsed().count());
+
+			line.iterations = state.getIterations();
+			line.nanosecondsPerIteration = nanoseconds / static_cast<double>(state.getIterations());
+
+			if (state.getItemsProcessed() != 0 && nanoseconds > 0)
+				line.itemsPerSecond = static_cast<double>(state.getItemsProcessed()) * 1e9 / nanoseconds;
+		}
+		catch (const std::exception& e)
+		{
+			std::fprintf(stderr, "%.*s: %s\n", static_cast<int>(benchmark.name.size()), benchmark.name.data(),
+				e.what());
+			line.error = e.what();
+			result = 1;
+		}
+
+		if (!options.json && line.error.empty())
+		{
+			std::printf("%-48.*s %14llu %14.1f", static_cast<int>(line.name.size()), line.name.data(),
+				static_cast<unsigned long long>(line.iterations), line.nanosecondsPerIteration);
+
+			if (line.itemsPerSecond > 0)
+				std::printf(" %16.0f", line.itemsPerSecond);
+
+			std::printf("\n");
+			std::fflush(stdout);
+		}
+	}
+
+	if (options.json)
+		printJson(results, options);
+
+	CLIENT.shutdown();
+
+	return result;
+}
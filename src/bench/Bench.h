@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BENCH_BENCH_H
+#define FBCPP_BENCH_BENCH_H
+
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Client.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace fbcpp::bench
+{
+	extern Client CLIENT;
+
+	///
+	/// Returns a database path for `name` in FBCPP_BENCH_DIR, or the system temporary directory.
+	/// FBCPP_BENCH_SERVER, when set, is used as the server prefix.
+	///
+	std::string getTempFile(std::string_view name);
+
+	///
+	/// Creates a scratch database that is dropped on destruction.
+	/// A failed drop is reported to stderr instead of being thrown.
+	///
+	class BenchDatabase final
+	{
+	public:
+		explicit BenchDatabase(std::string_view name)
+			: attachment{CLIENT, getTempFile(name), AttachmentOptions().setCreateDatabase(true)}
+		{
+		}
+
+		// A failed drop must not terminate the run and lose its report; the leftover file is only reported.
+		~BenchDatabase() noexcept
+		{
+			try
+			{
+				attachment.dropDatabase();
+			}
+			catch (const std::exception& e)
+			{
+				std::fprintf(stderr, "Cannot drop benchmark database: %s\n", e.what());
+			}
+		}
+
+		BenchDatabase(const BenchDatabase&) = delete;
+		BenchDatabase& operator=(const BenchDatabase&) = delete;
+
+	public:
+		Attachment& getAttachment() noexcept
+		{
+			return attachment;
+		}
+
+	private:
+		Attachment attachment;
+	};
+
+	///
+	/// Iteration control handed to each benchmark function.
+	/// The measured region is the `while (state.keepRunning())` loop.
+	///
+	class State final
+	{
+	public:
+		explicit State(std::uint64_t iterations)
+			: iterations{iterations},
+			  remaining{iterations}
+		{
+		}
+
+	public:
+		bool keepRunning()
+		{
+			if (!started) [[unlikely]]
+			{
+				started = true;
+				startTime = std::chrono::steady_clock::now();
+			}
+
+			if (remaining == 0) [[unlikely]]
+			{
+				elapsed += std::chrono::steady_clock::now() - startTime;
+				return false;
+			}
+
+			--remaining;
+			return true;
+		}
+
+		std::uint64_t getIterations() const
+		{
+			return iterations;
+		}
+
+		std::chrono::nanoseconds getElapsed() const
+		{
+			return elapsed;
+		}
+
+		///
+		/// Sets the number of logical items (rows, values...) processed by the whole run.
+		///
+		void setItemsProcessed(std::uint64_t value)
+		{
+			itemsProcessed = value;
+		}
+
+		std::uint64_t getItemsProcessed() const
+		{
+			return itemsProcessed;
+		}
+
+	private:
+		std::uint64_t iterations;
+		std::uint64_t remaining;
+		std::uint64_t itemsProcessed = 0;
+		bool started = false;
+		std::chrono::steady_clock::time_point startTime;
+		std::chrono::nanoseconds elapsed{};
+	};
+
+	using BenchmarkFunction = void (*)(State& state);
+
+	struct Benchmark final
+	{
+		std::string_view name;
+		BenchmarkFunction function;
+	};
+
+	std::vector<Benchmark>& getBenchmarks();
+
+	struct BenchmarkRegistrar final
+	{
+		BenchmarkRegistrar(std::string_view name, BenchmarkFunction function)
+		{
+			getBenchmarks().push_back(Benchmark{name, function});
+		}
+	};
+
+	///
+	/// Prevents the compiler from discarding a computed value.
+	///
+	template <typename T>
+	inline void doNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+	}
+}  // namespace fbcpp::bench
+
+
+#define FBCPP_BENCHMARK(name)                                                                   \
+	static void name(::fbcpp::bench::State& state);                                             \
+	static const ::fbcpp::bench::BenchmarkRegistrar name##Registrar{#name, name};               \
+	static void name(::fbcpp::bench::State& state)
+
+#endif  // FBCPP_BENCH_BENCH_H
@@ -0,0 +1,200 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/BlobStream.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	constexpr std::size_t BLOB_SIZE = 4 * 1024 * 1024;
+	constexpr std::size_t SMALL_BLOB_SIZE = 200;
+	constexpr unsigned SMALL_BLOB_ROWS = 1000;
+
+	const auto STREAM_OPTIONS = BlobOptions().setType(BlobType::STREAM);
+
+	std::vector<std::byte> makePayload(std::size_t size)
+	{
+		std::vector<std::byte> payload(size);
+
+		for (std::size_t i = 0; i < size; ++i)
+			payload[i] = static_cast<std::byte>(i * 31 + 7);
+
+		return payload;
+	}
+
+	BlobId writeBlob(Attachment& attachment, Transaction& transaction, const std::vector<std::byte>& payload)
+	{
+		Blob blob{attachment, transaction, STREAM_OPTIONS};
+		blob.write(payload);
+		blob.close();
+		return blob.getId();
+	}
+
+	// Compares reading small BLOB columns through a Blob handle per row against the inline blob threshold.
+	template <bool INLINE>
+	void runSmallBlobScan(bench::State& state, const char* databaseName)
+	{
+		bench::BenchDatabase database{databaseName};
+		auto& attachment = database.getAttachment();
+
+		{
+			Transaction transaction{attachment};
+			Statement ddl{
+				attachment, transaction, "create table bench_blob (id integer not null primary key, data blob)"};
+			ddl.execute(transaction);
+			transaction.commit();
+		}
+
+		{
+			Transaction transaction{attachment};
+			Statement insert{attachment, transaction, "insert into bench_blob (id, data) values (?, ?)"};
+			const auto payload = makePayload(SMALL_BLOB_SIZE);
+
+			for (std::int32_t id = 1; id <= static_cast<std::int32_t>(SMALL_BLOB_ROWS); ++id)
+			{
+				insert.setInt32(0, id);
+				insert.setBlobId(1, writeBlob(attachment, transaction, payload));
+				insert.execute(transaction);
+			}
+
+			insert.free();
+			transaction.commit();
+		}
+
+		Transaction transaction{attachment};
+		Statement select{attachment, transaction, "select data from bench_blob",
+			StatementOptions().setInlineBlobThreshold(INLINE ? SMALL_BLOB_SIZE : 0)};
+		std::string data;
+		std::uint64_t rowCount = 0;
+
+		while (state.keepRunning())
+		{
+			for (bool found = select.execute(transaction); found; found = select.fetchNext())
+			{
+				if constexpr (INLINE)
+					data = select.getString(0).value();
+				else
+				{
+					data.clear();
+					Blob blob{attachment, transaction, select.getBlobId(0).value(), STREAM_OPTIONS};
+					blob.readAll(data);
+				}
+
+				bench::doNotOptimize(data);
+				++rowCount;
+			}
+		}
+
+		select.free();
+		transaction.commit();
+		state.setItemsProcessed(rowCount);
+	}
+}  // namespace
+
+
+FBCPP_BENCHMARK(Blob_write)
+{
+	bench::BenchDatabase database{"Blob_write"};
+	auto& attachment = database.getAttachment();
+	const auto payload = makePayload(BLOB_SIZE);
+
+	Transaction transaction{attachment};
+
+	while (state.keepRunning())
+		bench::doNotOptimize(writeBlob(attachment, transaction, payload));
+
+	transaction.rollback();
+	state.setItemsProcessed(state.getIterations() * BLOB_SIZE);
+}
+
+FBCPP_BENCHMARK(Blob_writePipelined)
+{
+	bench::BenchDatabase database{"Blob_writePipelined"};
+	auto& attachment = database.getAttachment();
+	const auto payload = makePayload(BLOB_SIZE);
+	constexpr std::size_t CHUNK_SIZE = 64 * 1024;
+
+	Transaction transaction{attachment};
+
+	while (state.keepRunning())
+	{
+		Blob blob{attachment, transaction, STREAM_OPTIONS};
+		BlobWriter writer{blob};
+
+		for (std::size_t offset = 0; offset < payload.size(); offset += CHUNK_SIZE)
+			writer.write(std::span{payload}.subspan(offset, CHUNK_SIZE));
+
+		writer.finish();
+		blob.close();
+	}
+
+	transaction.rollback();
+	state.setItemsProcessed(state.getIterations() * BLOB_SIZE);
+}
+
+FBCPP_BENCHMARK(Blob_readAll)
+{
+	bench::BenchDatabase database{"Blob_readAll"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	const auto blobId = writeBlob(attachment, transaction, makePayload(BLOB_SIZE));
+
+	while (state.keepRunning())
+	{
+		Blob blob{attachment, transaction, blobId, STREAM_OPTIONS};
+		const auto data = blob.readAll();
+
+		if (data.size() != BLOB_SIZE)
+			throw std::runtime_error{"Unexpected blob size"};
+
+		bench::doNotOptimize(data);
+	}
+
+	transaction.rollback();
+	state.setItemsProcessed(state.getIterations() * BLOB_SIZE);
+}
+
+FBCPP_BENCHMARK(Blob_scanSmallHandle)
+{
+	runSmallBlobScan<false>(state, "Blob_scanSmallHandle");
+}
+
+FBCPP_BENCHMARK(Blob_scanSmallInline)
+{
+	runSmallBlobScan<true>(state, "Blob_scanSmallInline");
+}
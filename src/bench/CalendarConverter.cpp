@@ -0,0 +1,297 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include "fb-cpp/CalendarConverter.h"
+#include "fb-cpp/types.h"
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	constexpr std::array DATES{
+		std::string_view{"2024-02-29"},
+		std::string_view{" 1999 - 12 - 31 "},
+		std::string_view{"0001-01-01"},
+		std::string_view{"2038-01-19"},
+	};
+
+	constexpr std::array TIMES{
+		std::string_view{"23:59:59.9999"},
+		std::string_view{"00:00:00"},
+		std::string_view{" 12 : 34 : 56 . 7 "},
+		std::string_view{"08:15:30.25"},
+	};
+
+	constexpr std::array TIMESTAMPS{
+		std::string_view{"2024-02-29 23:59:59.9999"},
+		std::string_view{"1999-12-31 00:00:00"},
+		std::string_view{" 2000-01-01  12:34:56.7 "},
+		std::string_view{"2038-01-19 03:14:07.5"},
+	};
+
+	// The std::regex based parsers CalendarConverter used before its hand-written scanners, kept as a baseline.
+	namespace regex_reference
+	{
+		unsigned parseComponent(const std::string& text, const std::smatch& matches, std::size_t index)
+		{
+			unsigned result;
+			const auto begin = text.data() + matches.position(static_cast<int>(index));
+			const auto end = begin + matches.length(static_cast<int>(index));
+			const auto [ptr, ec] = std::from_chars(begin, end, result, 10);
+
+			if (ec != std::errc{} || ptr != end)
+				throw std::invalid_argument{"Invalid component"};
+
+			return result;
+		}
+
+		unsigned parseFractions(const std::string& text, const std::smatch& matches, std::size_t index)
+		{
+			if (!matches[static_cast<int>(index)].matched || matches.length(static_cast<int>(index)) == 0)
+				return 0;
+
+			auto fractions = parseComponent(text, matches, index);
+
+			for (auto remaining = 4 - matches.length(static_cast<int>(index)); remaining > 0; --remaining)
+				fractions *= 10;
+
+			return fractions;
+		}
+
+		Date stringToDate(std::string_view value)
+		{
+			static const std::regex pattern(R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s*$)");
+
+			const std::string stringValue{value};
+
+			std::smatch matches;
+			if (!std::regex_match(stringValue, matches, pattern))
+				throw std::invalid_argument{"Invalid date"};
+
+			const Date date{std::chrono::year{static_cast<int>(parseComponent(stringValue, matches, 1))},
+				std::chrono::month{parseComponent(stringValue, matches, 2)},
+				std::chrono::day{parseComponent(stringValue, matches, 3)}};
+
+			if (!date.ok())
+				throw std::invalid_argument{"Invalid date"};
+
+			return date;
+		}
+
+		Time stringToTime(std::string_view value)
+		{
+			static const std::regex pattern(
+				R"(^\s*([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s*$)");
+
+			const std::string stringValue{value};
+
+			std::smatch matches;
+			if (!std::regex_match(stringValue, matches, pattern))
+				throw std::invalid_argument{"Invalid time"};
+
+			const auto hours = parseComponent(stringValue, matches, 1);
+			const auto minutes = parseComponent(stringValue, matches, 2);
+			const auto seconds = parseComponent(stringValue, matches, 3);
+			const auto fractions = parseFractions(stringValue, matches, 4);
+
+			if (hours >= 24 || minutes >= 60 || seconds >= 60)
+				throw std::invalid_argument{"Invalid time"};
+
+			return Time{std::chrono::hours{hours} + std::chrono::minutes{minutes} + std::chrono::seconds{seconds} +
+				std::chrono::microseconds{static_cast<std::int64_t>(fractions) * 100}};
+		}
+
+		Timestamp stringToTimestamp(std::string_view value)
+		{
+			static const std::regex pattern(
+				R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s+([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s*$)");
+
+			const std::string stringValue{value};
+
+			std::smatch matches;
+			if (!std::regex_match(stringValue, matches, pattern))
+				throw std::invalid_argument{"Invalid timestamp"};
+
+			const Date date{std::chrono::year{static_cast<int>(parseComponent(stringValue, matches, 1))},
+				std::chrono::month{parseComponent(stringValue, matches, 2)},
+				std::chrono::day{parseComponent(stringValue, matches, 3)}};
+
+			const auto hours = parseComponent(stringValue, matches, 4);
+			const auto minutes = parseComponent(stringValue, matches, 5);
+			const auto seconds = parseComponent(stringValue, matches, 6);
+			const auto fractions = parseFractions(stringValue, matches, 7);
+
+			if (!date.ok() || hours >= 24 || minutes >= 60 || seconds >= 60)
+				throw std::invalid_argument{"Invalid timestamp"};
+
+			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
+				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(fractions) * 100};
+
+			return Timestamp{date, Time{timeOfDay}};
+		}
+	}  // namespace regex_reference
+
+	// Decodes through fbclient's IUtil, as CalendarConverter did before its constexpr arithmetic.
+	Timestamp utilOpaqueTimestampToTimestamp(fb::IUtil* util, OpaqueTimestamp timestamp)
+	{
+		unsigned year;
+		unsigned month;
+		unsigned day;
+		unsigned hours;
+		unsigned minutes;
+		unsigned seconds;
+		unsigned subseconds;
+
+		util->decodeDate(timestamp.value.timestamp_date, &year, &month, &day);
+		util->decodeTime(timestamp.value.timestamp_time, &hours, &minutes, &seconds, &subseconds);
+
+		const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
+			std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(subseconds) * 100};
+
+		return Timestamp{
+			Date{std::chrono::year{static_cast<int>(year)}, std::chrono::month{month}, std::chrono::day{day}},
+			Time{timeOfDay}};
+	}
+
+	std::vector<OpaqueTimestamp> makeOpaqueTimestamps(std::size_t count)
+	{
+		std::vector<OpaqueTimestamp> timestamps(count);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			timestamps[i].value.timestamp_date = static_cast<ISC_DATE>(40000 + i * 7);
+			timestamps[i].value.timestamp_time = static_cast<ISC_TIME>(i * 104729 % 864000000);
+		}
+
+		return timestamps;
+	}
+
+	constexpr std::size_t TIMESTAMP_BATCH_SIZE = 1024;
+
+	template <typename Inputs, typename Parse>
+	void runParse(bench::State& state, const Inputs& inputs, Parse parse)
+	{
+		std::size_t index = 0;
+
+		while (state.keepRunning())
+		{
+			bench::doNotOptimize(parse(inputs[index]));
+			index = (index + 1) % inputs.size();
+		}
+
+		state.setItemsProcessed(state.getIterations());
+	}
+
+	template <typename Inputs, typename Parse>
+	void runConverterParse(bench::State& state, const Inputs& inputs, Parse parse)
+	{
+		const auto status = bench::CLIENT.newStatus();
+		impl::StatusWrapper statusWrapper{bench::CLIENT, status.get()};
+		impl::CalendarConverter converter{bench::CLIENT, &statusWrapper};
+
+		runParse(state, inputs, [&](std::string_view value) { return parse(converter, value); });
+	}
+}  // namespace
+
+
+FBCPP_BENCHMARK(CalendarConverter_stringToDate_regex)
+{
+	runParse(state, DATES, regex_reference::stringToDate);
+}
+
+FBCPP_BENCHMARK(CalendarConverter_stringToDate)
+{
+	runConverterParse(state, DATES,
+		[](impl::CalendarConverter& converter, std::string_view value) { return converter.stringToDate(value); });
+}
+
+FBCPP_BENCHMARK(CalendarConverter_stringToTime_regex)
+{
+	runParse(state, TIMES, regex_reference::stringToTime);
+}
+
+FBCPP_BENCHMARK(CalendarConverter_stringToTime)
+{
+	runConverterParse(state, TIMES,
+		[](impl::CalendarConverter& converter, std::string_view value) { return converter.stringToTime(value); });
+}
+
+FBCPP_BENCHMARK(CalendarConverter_stringToTimestamp_regex)
+{
+	runParse(state, TIMESTAMPS, regex_reference::stringToTimestamp);
+}
+
+FBCPP_BENCHMARK(CalendarConverter_stringToTimestamp)
+{
+	runConverterParse(state, TIMESTAMPS,
+		[](impl::CalendarConverter& converter, std::string_view value) { return converter.stringToTimestamp(value); });
+}
+
+FBCPP_BENCHMARK(CalendarConverter_opaqueTimestampToTimestamp_util)
+{
+	const auto source = makeOpaqueTimestamps(TIMESTAMP_BATCH_SIZE);
+	std::vector<Timestamp> destination(source.size());
+	const auto util = bench::CLIENT.getUtil();
+
+	while (state.keepRunning())
+	{
+		for (std::size_t i = 0; i < source.size(); ++i)
+			destination[i] = utilOpaqueTimestampToTimestamp(util, source[i]);
+
+		bench::doNotOptimize(destination.data());
+	}
+
+	state.setItemsProcessed(state.getIterations() * source.size());
+}
+
+FBCPP_BENCHMARK(CalendarConverter_opaqueTimestampsToTimestamps)
+{
+	const auto status = bench::CLIENT.newStatus();
+	impl::StatusWrapper statusWrapper{bench::CLIENT, status.get()};
+	impl::CalendarConverter converter{bench::CLIENT, &statusWrapper};
+
+	const auto source = makeOpaqueTimestamps(TIMESTAMP_BATCH_SIZE);
+	std::vector<Timestamp> destination(source.size());
+
+	while (state.keepRunning())
+	{
+		converter.opaqueTimestampsToTimestamps(source, destination);
+		bench::doNotOptimize(destination.data());
+	}
+
+	state.setItemsProcessed(state.getIterations() * source.size());
+}
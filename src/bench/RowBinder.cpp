@@ -0,0 +1,102 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include "fb-cpp/RowBinder.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	struct Row
+	{
+		std::int32_t id;
+		std::optional<std::string> name;
+		double amount;
+		std::optional<std::int64_t> parent;
+		Date day;
+		Timestamp moment;
+	};
+
+	constexpr auto ROW_SQL =
+		"select 1, cast('some name' as varchar(40)), cast(12.5 as double precision), cast(null as bigint), "
+		"date '2024-02-29', timestamp '2024-02-29 13:14:15.1234' from rdb$database";
+
+	// Extraction is measured on one fetched row so fetch cost does not dominate.
+	template <typename Extract>
+	void runExtraction(bench::State& state, const char* databaseName, Extract extract)
+	{
+		bench::BenchDatabase database{databaseName};
+		auto& attachment = database.getAttachment();
+
+		Transaction transaction{attachment};
+		Statement statement{attachment, transaction, ROW_SQL};
+
+		if (!statement.execute(transaction))
+			throw std::runtime_error{"Expected one row"};
+
+		extract(state, statement);
+		statement.free();
+		transaction.commit();
+	}
+}  // namespace
+
+
+FBCPP_BENCHMARK(RowBinder_statementGetStruct)
+{
+	runExtraction(state, "RowBinder_statementGetStruct",
+		[](bench::State& state, Statement& statement)
+		{
+			while (state.keepRunning())
+				bench::doNotOptimize(statement.get<Row>());
+
+			state.setItemsProcessed(state.getIterations());
+		});
+}
+
+FBCPP_BENCHMARK(RowBinder_read)
+{
+	runExtraction(state, "RowBinder_read",
+		[](bench::State& state, Statement& statement)
+		{
+			RowBinder<Row> binder{statement};
+			Row row{};
+
+			while (state.keepRunning())
+			{
+				binder.read(row);
+				bench::doNotOptimize(row);
+			}
+
+			state.setItemsProcessed(state.getIterations());
+		});
+}
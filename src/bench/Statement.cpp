@@ -0,0 +1,428 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include "fb-cpp/ColumnarResult.h"
+#include "fb-cpp/RowRange.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	struct ScanRow
+	{
+		std::int32_t id;
+		std::int64_t code;
+		double amount;
+		std::optional<std::string> name;
+		Date day;
+		Timestamp moment;
+	};
+
+	constexpr unsigned SCAN_ROWS = 10000;
+	constexpr unsigned INSERT_BATCH_ROWS = 1000;
+	// Rows per fetchBlock() call in the block based scans; row at a time fetches ignore it.
+	constexpr unsigned SCAN_FETCH_BUFFER_ROWS = 1000;
+
+	constexpr auto SCAN_SQL = "select id, code, amount, name, day, moment from bench_row";
+	constexpr auto INSERT_SQL = "insert into bench_row (id, code, amount, name, day, moment) values (?, ?, ?, ?, ?, ?)";
+
+	void createTable(Attachment& attachment)
+	{
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction,
+			"create table bench_row (id integer not null primary key, code bigint, amount double precision, "
+			"name varchar(40), day date, moment timestamp)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	constexpr Date DAY{std::chrono::year{2024}, std::chrono::February, std::chrono::day{29}};
+
+	void bindRow(Statement& insert, std::int32_t id)
+	{
+		insert.setInt32(0, id);
+		insert.setInt64(1, std::int64_t{id} * 1000);
+		insert.setDouble(2, id * 0.25);
+		insert.setString(3, "name " + std::to_string(id));
+		insert.setDate(4, DAY);
+		insert.setTimestamp(5, Timestamp{DAY, Time{std::chrono::hours{13} + std::chrono::minutes{id % 60}}});
+	}
+
+	// Database with SCAN_ROWS rows in bench_row, shared by the point select and scan cases.
+	class ScanDatabase final
+	{
+	public:
+		explicit ScanDatabase(std::string_view name)
+			: database{name}
+		{
+			auto& attachment = database.getAttachment();
+			createTable(attachment);
+
+			Transaction transaction{attachment};
+			Statement insert{attachment, transaction, INSERT_SQL};
+
+			for (std::int32_t id = 1; id <= static_cast<std::int32_t>(SCAN_ROWS); ++id)
+			{
+				bindRow(insert, id);
+				insert.addBatch();
+			}
+
+			insert.executeBatch(transaction);
+			insert.free();
+			transaction.commit();
+		}
+
+	public:
+		Attachment& getAttachment() noexcept
+		{
+			return database.getAttachment();
+		}
+
+	private:
+		bench::BenchDatabase database;
+	};
+
+	// Runs the scan query once per iteration; readRows consumes the open cursor and returns the row count.
+	template <typename ReadRows>
+	void runScan(bench::State& state, const char* databaseName, ReadRows readRows)
+	{
+		ScanDatabase database{databaseName};
+		auto& attachment = database.getAttachment();
+
+		Transaction transaction{attachment};
+		Statement select{
+			attachment, transaction, SCAN_SQL, StatementOptions().setFetchBufferRows(SCAN_FETCH_BUFFER_ROWS)};
+		std::uint64_t rowCount = 0;
+
+		while (state.keepRunning())
+		{
+			const auto count = readRows(transaction, select);
+
+			if (count != SCAN_ROWS)
+				throw std::runtime_error{"Unexpected row count"};
+
+			rowCount += count;
+		}
+
+		select.free();
+		transaction.commit();
+		state.setItemsProcessed(rowCount);
+	}
+
+	// Conversions are measured on one fetched row so fetch cost does not dominate.
+	template <typename Convert>
+	void runConversion(bench::State& state, const char* databaseName, const char* sql, Convert convert)
+	{
+		bench::BenchDatabase database{databaseName};
+		auto& attachment = database.getAttachment();
+
+		Transaction transaction{attachment};
+		Statement statement{attachment, transaction, sql};
+
+		if (!statement.execute(transaction))
+			throw std::runtime_error{"Expected one row"};
+
+		convert(state, statement);
+
+		statement.free();
+		transaction.commit();
+		state.setItemsProcessed(state.getIterations());
+	}
+}  // namespace
+
+
+FBCPP_BENCHMARK(Statement_prepare)
+{
+	bench::BenchDatabase database{"Statement_prepare"};
+	auto& attachment = database.getAttachment();
+	createTable(attachment);
+
+	Transaction transaction{attachment};
+
+	while (state.keepRunning())
+	{
+		Statement statement{attachment, transaction, "select id, code, amount, name from bench_row where id = ?"};
+		statement.free();
+	}
+
+	transaction.commit();
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Statement_insertSingle)
+{
+	bench::BenchDatabase database{"Statement_insertSingle"};
+	auto& attachment = database.getAttachment();
+	createTable(attachment);
+
+	Transaction transaction{attachment};
+	Statement insert{attachment, transaction, INSERT_SQL};
+	std::int32_t id = 0;
+
+	while (state.keepRunning())
+	{
+		bindRow(insert, ++id);
+		insert.execute(transaction);
+	}
+
+	insert.free();
+	transaction.commit();
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Statement_insertBatch)
+{
+	bench::BenchDatabase database{"Statement_insertBatch"};
+	auto& attachment = database.getAttachment();
+	createTable(attachment);
+
+	Transaction transaction{attachment};
+	Statement insert{attachment, transaction, INSERT_SQL};
+	std::int32_t id = 0;
+	unsigned pending = 0;
+
+	while (state.keepRunning())
+	{
+		bindRow(insert, ++id);
+		insert.addBatch();
+
+		if (++pending == INSERT_BATCH_ROWS)
+		{
+			insert.executeBatch(transaction);
+			pending = 0;
+		}
+	}
+
+	if (pending != 0)
+		insert.executeBatch(transaction);
+
+	insert.free();
+	transaction.commit();
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Statement_pointSelect)
+{
+	ScanDatabase database{"Statement_pointSelect"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	Statement select{attachment, transaction, "select code, amount, name from bench_row where id = ?"};
+	std::int32_t id = 0;
+
+	while (state.keepRunning())
+	{
+		select.setInt32(0, id % static_cast<std::int32_t>(SCAN_ROWS) + 1);
+		++id;
+
+		if (!select.execute(transaction))
+			throw std::runtime_error{"Expected one row"};
+
+		bench::doNotOptimize(select.getInt64(0));
+	}
+
+	select.free();
+	transaction.commit();
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Scan_typedGetters)
+{
+	runScan(state, "Scan_typedGetters",
+		[](Transaction& transaction, Statement& select)
+		{
+			unsigned count = 0;
+
+			for (bool found = select.execute(transaction); found; found = select.fetchNext())
+			{
+				bench::doNotOptimize(select.getInt32(0));
+				bench::doNotOptimize(select.getInt64(1));
+				bench::doNotOptimize(select.getDouble(2));
+				bench::doNotOptimize(select.getString(3));
+				bench::doNotOptimize(select.getDate(4));
+				bench::doNotOptimize(select.getTimestamp(5));
+				++count;
+			}
+
+			return count;
+		});
+}
+
+FBCPP_BENCHMARK(Scan_getStringView)
+{
+	runScan(state, "Scan_getStringView",
+		[](Transaction& transaction, Statement& select)
+		{
+			unsigned count = 0;
+
+			for (bool found = select.execute(transaction); found; found = select.fetchNext())
+			{
+				bench::doNotOptimize(select.getStringView(3));
+				++count;
+			}
+
+			return count;
+		});
+}
+
+FBCPP_BENCHMARK(Scan_getStringTo)
+{
+	runScan(state, "Scan_getStringTo",
+		[](Transaction& transaction, Statement& select)
+		{
+			unsigned count = 0;
+			std::string name;
+
+			for (bool found = select.execute(transaction); found; found = select.fetchNext())
+			{
+				select.getStringTo(3, name);
+				bench::doNotOptimize(name);
+				++count;
+			}
+
+			return count;
+		});
+}
+
+FBCPP_BENCHMARK(Scan_getStruct)
+{
+	runScan(state, "Scan_getStruct",
+		[](Transaction& transaction, Statement& select)
+		{
+			unsigned count = 0;
+
+			for (bool found = select.execute(transaction); found; found = select.fetchNext())
+			{
+				bench::doNotOptimize(select.get<ScanRow>());
+				++count;
+			}
+
+			return count;
+		});
+}
+
+FBCPP_BENCHMARK(Scan_rowRange)
+{
+	runScan(state, "Scan_rowRange",
+		[](Transaction& transaction, Statement& select)
+		{
+			unsigned count = 0;
+
+			for (const auto& row : select.rows<ScanRow>(transaction))
+			{
+				bench::doNotOptimize(row);
+				++count;
+			}
+
+			return count;
+		});
+}
+
+FBCPP_BENCHMARK(Scan_fetchBlock)
+{
+	runScan(state, "Scan_fetchBlock",
+		[](Transaction& transaction, Statement& select)
+		{
+			unsigned count = 0;
+			select.execute(transaction);
+
+			for (auto block = select.fetchBlock(); !block.empty(); block = select.fetchBlock())
+			{
+				for (const auto row : block)
+				{
+					select.setCurrentRow(row);
+					bench::doNotOptimize(select.getInt32(0));
+					bench::doNotOptimize(select.getInt64(1));
+					bench::doNotOptimize(select.getDouble(2));
+					++count;
+				}
+			}
+
+			return count;
+		});
+}
+
+FBCPP_BENCHMARK(Scan_columnar)
+{
+	runScan(state, "Scan_columnar",
+		[](Transaction& transaction, Statement& select)
+		{
+			select.execute(transaction);
+
+			ColumnarResult result{select};
+			result.drain(select);
+			bench::doNotOptimize(result.getColumn(0));
+
+			return static_cast<unsigned>(result.getRowCount());
+		});
+}
+
+FBCPP_BENCHMARK(Conversion_getStringFromDate)
+{
+	runConversion(state, "Conversion_getStringFromDate",
+		"select timestamp '2024-02-29 13:14:15.1234' from rdb$database",
+		[](bench::State& state, Statement& statement)
+		{
+			while (state.keepRunning())
+				bench::doNotOptimize(statement.getString(0));
+		});
+}
+
+FBCPP_BENCHMARK(Conversion_getStringFromScaled)
+{
+	runConversion(state, "Conversion_getStringFromScaled",
+		"select cast(12345.67 as numeric(18, 2)) from rdb$database",
+		[](bench::State& state, Statement& statement)
+		{
+			while (state.keepRunning())
+				bench::doNotOptimize(statement.getString(0));
+		});
+}
+
+FBCPP_BENCHMARK(Conversion_setStringToDate)
+{
+	bench::BenchDatabase database{"Conversion_setStringToDate"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+	Statement statement{attachment, transaction, "select cast(? as timestamp) from rdb$database"};
+
+	while (state.keepRunning())
+		statement.setString(0, "2024-02-29 13:14:15.1234");
+
+	statement.free();
+	transaction.commit();
+	state.setItemsProcessed(state.getIterations());
+}
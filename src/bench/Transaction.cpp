@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Bench.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+
+using namespace fbcpp;
+
+
+// Cost of the status allocation that Transaction and Attachment used to pay on every call.
+FBCPP_BENCHMARK(Client_newStatus)
+{
+	while (state.keepRunning())
+		bench::doNotOptimize(CLIENT.newStatus());
+
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Transaction_startCommit)
+{
+	bench::BenchDatabase database{"Transaction_startCommit"};
+	auto& attachment = database.getAttachment();
+
+	const auto options = TransactionOptions().setWaitMode(TransactionWaitMode::NO_WAIT);
+
+	while (state.keepRunning())
+	{
+		Transaction transaction{attachment, options};
+		transaction.commit();
+	}
+
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Transaction_commitRetaining)
+{
+	bench::BenchDatabase database{"Transaction_commitRetaining"};
+	auto& attachment = database.getAttachment();
+
+	Transaction transaction{attachment};
+
+	while (state.keepRunning())
+		transaction.commitRetaining();
+
+	transaction.commit();
+	state.setItemsProcessed(state.getIterations());
+}
+
+// Short OLTP transactions: one insert per transaction.
+FBCPP_BENCHMARK(Transaction_insertCommit)
+{
+	bench::BenchDatabase database{"Transaction_insertCommit"};
+	auto& attachment = database.getAttachment();
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "create table bench_commit (id bigint)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	Transaction prepareTransaction{attachment};
+	Statement insert{attachment, prepareTransaction, "insert into bench_commit (id) values (?)"};
+	prepareTransaction.commit();
+
+	std::int64_t id = 0;
+
+	while (state.keepRunning())
+	{
+		Transaction transaction{attachment};
+		insert.setInt64(0, ++id);
+		insert.execute(transaction);
+		transaction.commit();
+	}
+
+	insert.free();
+	state.setItemsProcessed(state.getIterations());
+}
+
+FBCPP_BENCHMARK(Transaction_startCommitCompiled)
+{
+	bench::BenchDatabase database{"Transaction_startCommitCompiled"};
+	auto& attachment = database.getAttachment();
+
+	const CompiledTransactionOptions options{CLIENT, TransactionOptions().setWaitMode(TransactionWaitMode::NO_WAIT)};
+
+	while (state.keepRunning())
+	{
+		Transaction transaction{attachment, options};
+		transaction.commit();
+	}
+
+	state.setItemsProcessed(state.getIterations());
+}
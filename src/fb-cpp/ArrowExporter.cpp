@@ -0,0 +1,462 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ArrowExporter.h"
+#include "Statement.h"
+#include "Exception.h"
+#include <format>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <cstring>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	// Days between the Firebird date epoch (1858-11-17) and the Unix epoch.
+	constexpr std::int32_t UNIX_EPOCH_DAYS = 40587;
+	constexpr std::int64_t MICROSECONDS_PER_DAY = std::int64_t{24} * 60 * 60 * 1000000;
+	// Firebird times are expressed in units of 100 microseconds.
+	constexpr std::int64_t MICROSECONDS_PER_TICK = 100;
+
+	// Non-null address used for buffers of empty arrays.
+	alignas(64) constexpr std::uint8_t EMPTY_BUFFER[64] = {};
+
+	struct SchemaPrivate final
+	{
+		std::string format;
+		std::string name;
+		std::vector<ArrowSchema> children;
+		std::vector<ArrowSchema*> childPointers;
+	};
+
+	struct ArrayPrivate final
+	{
+		std::vector<std::uint8_t> validity;
+		std::vector<std::byte> values;
+		std::vector<std::int32_t> offsets;
+		std::vector<char> stringData;
+		std::vector<const void*> buffers;
+		std::vector<ArrowArray> children;
+		std::vector<ArrowArray*> childPointers;
+	};
+
+	void releaseSchema(ArrowSchema* schema)
+	{
+		if (!schema->release)
+			return;
+
+		const auto data = static_cast<SchemaPrivate*>(schema->private_data);
+
+		for (auto& child : data->children)
+		{
+			if (child.release)
+				child.release(&child);
+		}
+
+		delete data;
+		schema->release = nullptr;
+	}
+
+	void releaseArray(ArrowArray* array)
+	{
+		if (!array->release)
+			return;
+
+		const auto data = static_cast<ArrayPrivate*>(array->private_data);
+
+		for (auto& child : data->children)
+		{
+			if (child.release)
+				child.release(&child);
+		}
+
+		delete data;
+		array->release = nullptr;
+	}
+
+	std::string getFormat(const Descriptor& descriptor)
+	{
+		switch (descriptor.adjustedType)
+		{
+			case DescriptorAdjustedType::BOOLEAN:
+				return "b";
+
+			case DescriptorAdjustedType::INT16:
+				return descriptor.scale == 0 ? "s" : std::format("d:5,{}", -descriptor.scale);
+
+			case DescriptorAdjustedType::INT32:
+				return descriptor.scale == 0 ? "i" : std::format("d:10,{}", -descriptor.scale);
+
+			case DescriptorAdjustedType::INT64:
+				return descriptor.scale == 0 ? "l" : std::format("d:19,{}", -descriptor.scale);
+
+			case DescriptorAdjustedType::INT128:
+				return std::format("d:38,{}", -descriptor.scale);
+
+			case DescriptorAdjustedType::FLOAT:
+				return "f";
+
+			case DescriptorAdjustedType::DOUBLE:
+				return "g";
+
+			case DescriptorAdjustedType::DATE:
+				return "tdD";
+
+			case DescriptorAdjustedType::TIME:
+			case DescriptorAdjustedType::TIME_TZ:
+				return "ttu";
+
+			case DescriptorAdjustedType::TIMESTAMP:
+				return "tsu:";
+
+			case DescriptorAdjustedType::TIMESTAMP_TZ:
+				return "tsu:UTC";
+
+			case DescriptorAdjustedType::STRING:
+				return "u";
+
+			default:
+				throw FbCppException(std::format("Column '{}' has a type that cannot be exported to Arrow: {}",
+					descriptor.alias, static_cast<unsigned>(descriptor.adjustedType)));
+		}
+	}
+
+	void fillSchema(ArrowSchema* out, std::string format, std::string name, std::int64_t flags)
+	{
+		auto data = std::make_unique<SchemaPrivate>();
+		data->format = std::move(format);
+		data->name = std::move(name);
+
+		*out = ArrowSchema{
+			.format = data->format.c_str(),
+			.name = data->name.c_str(),
+			.metadata = nullptr,
+			.flags = flags,
+			.n_children = 0,
+			.children = nullptr,
+			.dictionary = nullptr,
+			.release = releaseSchema,
+			.private_data = data.release(),
+		};
+	}
+
+	template <typename From, typename To, typename F>
+	std::vector<std::byte> transform(const std::vector<std::byte>& values, std::size_t rowCount, F&& function)
+	{
+		std::vector<std::byte> result(rowCount * sizeof(To));
+
+		for (std::size_t row = 0; row < rowCount; ++row)
+		{
+			From from;
+			std::memcpy(&from, &values[row * sizeof(From)], sizeof(From));
+			const To to = function(from);
+			std::memcpy(&result[row * sizeof(To)], &to, sizeof(To));
+		}
+
+		return result;
+	}
+
+	template <typename T>
+	std::vector<std::byte> toDecimal128(const std::vector<std::byte>& values, std::size_t rowCount)
+	{
+		struct Decimal128
+		{
+			std::uint64_t low;
+			std::int64_t high;
+		};
+
+		return transform<T, Decimal128>(values, rowCount,
+			[](T value)
+			{
+				const auto wide = static_cast<std::int64_t>(value);
+				return Decimal128{static_cast<std::uint64_t>(wide), wide < 0 ? -1 : 0};
+			});
+	}
+
+	// decimal128 holds at most 38 digits, one less than INT128; reject the values in between.
+	void checkDecimal128Range(const Descriptor& descriptor, const std::vector<std::byte>& values, std::size_t rowCount)
+	{
+		// 10^38 as high and low 64-bit words.
+		constexpr std::uint64_t LIMIT_HIGH = 0x4B3B4CA85A86C47AULL;
+		constexpr std::uint64_t LIMIT_LOW = 0x098A224000000000ULL;
+
+		for (std::size_t row = 0; row < rowCount; ++row)
+		{
+			std::uint64_t words[2];
+			std::memcpy(words, &values[row * sizeof(words)], sizeof(words));
+
+			auto low = words[0];
+			auto high = words[1];
+
+			if (static_cast<std::int64_t>(high) < 0)
+			{
+				// Magnitude of a negative value.
+				low = ~low + 1;
+				high = ~high + (low == 0 ? 1 : 0);
+			}
+
+			if (high > LIMIT_HIGH || (high == LIMIT_HIGH && low >= LIMIT_LOW))
+			{
+				throw FbCppException(std::format(
+					"Column '{}' has a value that does not fit in an Arrow decimal128(38)", descriptor.alias));
+			}
+		}
+	}
+
+	std::vector<std::byte> convertValues(
+		const Descriptor& descriptor, std::vector<std::byte>&& values, std::size_t rowCount)
+	{
+		switch (descriptor.adjustedType)
+		{
+			case DescriptorAdjustedType::BOOLEAN:
+			{
+				std::vector<std::byte> bits((rowCount + 7u) / 8u);
+
+				for (std::size_t row = 0; row < rowCount; ++row)
+				{
+					if (values[row] != std::byte{0})
+						bits[row / 8u] |= std::byte{static_cast<std::uint8_t>(1u << (row % 8u))};
+				}
+
+				return bits;
+			}
+
+			case DescriptorAdjustedType::INT16:
+				return descriptor.scale == 0 ? std::move(values) : toDecimal128<std::int16_t>(values, rowCount);
+
+			case DescriptorAdjustedType::INT32:
+				return descriptor.scale == 0 ? std::move(values) : toDecimal128<std::int32_t>(values, rowCount);
+
+			case DescriptorAdjustedType::INT64:
+				return descriptor.scale == 0 ? std::move(values) : toDecimal128<std::int64_t>(values, rowCount);
+
+			case DescriptorAdjustedType::DATE:
+				for (std::size_t row = 0; row < rowCount; ++row)
+				{
+					std::int32_t date;
+					std::memcpy(&date, &values[row * sizeof(date)], sizeof(date));
+					date -= UNIX_EPOCH_DAYS;
+					std::memcpy(&values[row * sizeof(date)], &date, sizeof(date));
+				}
+
+				return std::move(values);
+
+			case DescriptorAdjustedType::TIME:
+				return transform<ISC_TIME, std::int64_t>(values, rowCount,
+					[](ISC_TIME time) { return static_cast<std::int64_t>(time) * MICROSECONDS_PER_TICK; });
+
+			case DescriptorAdjustedType::TIME_TZ:
+				return transform<ISC_TIME_TZ, std::int64_t>(values, rowCount,
+					[](const ISC_TIME_TZ& time)
+					{ return static_cast<std::int64_t>(time.utc_time) * MICROSECONDS_PER_TICK; });
+
+			case DescriptorAdjustedType::TIMESTAMP:
+				// Same width: convert in place.
+				for (std::size_t row = 0; row < rowCount; ++row)
+				{
+					ISC_TIMESTAMP timestamp;
+					std::memcpy(&timestamp, &values[row * sizeof(timestamp)], sizeof(timestamp));
+
+					const std::int64_t micros =
+						(static_cast<std::int64_t>(timestamp.timestamp_date) - UNIX_EPOCH_DAYS) * MICROSECONDS_PER_DAY +
+						static_cast<std::int64_t>(timestamp.timestamp_time) * MICROSECONDS_PER_TICK;
+
+					std::memcpy(&values[row * sizeof(micros)], &micros, sizeof(micros));
+				}
+
+				return std::move(values);
+
+			case DescriptorAdjustedType::TIMESTAMP_TZ:
+				return transform<ISC_TIMESTAMP_TZ, std::int64_t>(values, rowCount,
+					[](const ISC_TIMESTAMP_TZ& timestamp)
+					{
+						return (static_cast<std::int64_t>(timestamp.utc_timestamp.timestamp_date) - UNIX_EPOCH_DAYS) *
+							MICROSECONDS_PER_DAY +
+							static_cast<std::int64_t>(timestamp.utc_timestamp.timestamp_time) * MICROSECONDS_PER_TICK;
+					});
+
+			case DescriptorAdjustedType::INT128:
+				// Already a little-endian 128-bit integer.
+				checkDecimal128Range(descriptor, values, rowCount);
+				return std::move(values);
+
+			default:
+				// FLOAT and DOUBLE match as well.
+				return std::move(values);
+		}
+	}
+
+	const void* bufferAddress(const void* data) noexcept
+	{
+		return data ? data : EMPTY_BUFFER;
+	}
+}  // namespace
+
+
+ArrowExporter::ArrowExporter(Statement& statement, std::size_t batchRows)
+	: statement{statement},
+	  batchRows{batchRows}
+{
+	if (batchRows == 0u)
+		throw std::invalid_argument("batchRows must be greater than zero");
+}
+
+void ArrowExporter::exportSchema(ArrowSchema* out)
+{
+	exportSchema(statement.getOutputDescriptors(), out);
+}
+
+bool ArrowExporter::exportNextBatch(ArrowArray* out)
+{
+	// Validate the types before fetching, as fetched rows cannot be fetched again.
+	for (const auto& descriptor : statement.getOutputDescriptors())
+		getFormat(descriptor);
+
+	ColumnarResult result{statement};
+	result.reserve(batchRows);
+
+	if (result.drain(statement, batchRows) == 0u)
+		return false;
+
+	exportResult(std::move(result), out);
+	return true;
+}
+
+void ArrowExporter::exportSchema(const std::vector<Descriptor>& descriptors, ArrowSchema* out)
+{
+	ArrowSchema schema;
+	fillSchema(&schema, "+s", "", 0);
+
+	try
+	{
+		const auto data = static_cast<SchemaPrivate*>(schema.private_data);
+		data->children.resize(descriptors.size());
+
+		for (std::size_t index = 0; index < descriptors.size(); ++index)
+		{
+			const auto& descriptor = descriptors[index];
+
+			fillSchema(&data->children[index], getFormat(descriptor), descriptor.alias,
+				descriptor.isNullable ? ARROW_FLAG_NULLABLE : 0);
+		}
+
+		for (auto& child : data->children)
+			data->childPointers.push_back(&child);
+
+		schema.n_children = static_cast<std::int64_t>(data->children.size());
+		schema.children = data->childPointers.data();
+	}
+	catch (...)
+	{
+		releaseSchema(&schema);
+		throw;
+	}
+
+	*out = schema;
+}
+
+void ArrowExporter::exportResult(ColumnarResult&& result, ArrowArray* out)
+{
+	// Validate the types before moving anything out of the result.
+	for (const auto& column : result.getColumns())
+		getFormat(column.getDescriptor());
+
+	const auto rowCount = static_cast<std::int64_t>(result.getRowCount());
+	auto columns = result.releaseColumns();
+
+	auto data = std::make_unique<ArrayPrivate>();
+	data->buffers.push_back(nullptr);
+	data->children.resize(columns.size());
+
+	for (auto& child : data->children)
+		data->childPointers.push_back(&child);
+
+	ArrowArray array{
+		.length = rowCount,
+		.null_count = 0,
+		.offset = 0,
+		.n_buffers = 1,
+		.n_children = static_cast<std::int64_t>(data->children.size()),
+		.buffers = data->buffers.data(),
+		.children = data->childPointers.data(),
+		.dictionary = nullptr,
+		.release = releaseArray,
+		.private_data = data.get(),
+	};
+
+	const auto arrayData = data.release();
+
+	try
+	{
+		for (std::size_t index = 0; index < columns.size(); ++index)
+		{
+			auto& column = columns[index];
+			auto childData = std::make_unique<ArrayPrivate>();
+
+			const auto nullCount = static_cast<std::int64_t>(column.nullCount);
+
+			childData->validity = std::move(column.validity);
+			childData->buffers.push_back(nullCount == 0 ? nullptr : bufferAddress(childData->validity.data()));
+
+			if (column.isString())
+			{
+				childData->offsets = std::move(column.offsets);
+				childData->stringData = std::move(column.stringData);
+				childData->buffers.push_back(bufferAddress(childData->offsets.data()));
+				childData->buffers.push_back(bufferAddress(childData->stringData.data()));
+			}
+			else
+			{
+				childData->values = convertValues(column.descriptor, std::move(column.values), column.rowCount);
+				childData->buffers.push_back(bufferAddress(childData->values.data()));
+			}
+
+			arrayData->children[index] = ArrowArray{
+				.length = rowCount,
+				.null_count = nullCount,
+				.offset = 0,
+				.n_buffers = static_cast<std::int64_t>(childData->buffers.size()),
+				.n_children = 0,
+				.buffers = childData->buffers.data(),
+				.children = nullptr,
+				.dictionary = nullptr,
+				.release = releaseArray,
+				.private_data = childData.release(),
+			};
+		}
+	}
+	catch (...)
+	{
+		releaseArray(&array);
+		throw;
+	}
+
+	*out = array;
+}
@@ -0,0 +1,153 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ARROW_EXPORTER_H
+#define FBCPP_ARROW_EXPORTER_H
+
+#include "fb-cpp_api.h"
+#include "ColumnarResult.h"
+#include "Descriptor.h"
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+// Arrow C Data Interface structures, as defined by the Arrow specification.
+// The guard lets this header coexist with arrow/c/abi.h or other copies of the definitions.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C"
+{
+	struct ArrowSchema
+	{
+		const char* format;
+		const char* name;
+		const char* metadata;
+		int64_t flags;
+		int64_t n_children;
+		struct ArrowSchema** children;
+		struct ArrowSchema* dictionary;
+		void (*release)(struct ArrowSchema*);
+		void* private_data;
+	};
+
+	struct ArrowArray
+	{
+		int64_t length;
+		int64_t null_count;
+		int64_t offset;
+		int64_t n_buffers;
+		int64_t n_children;
+		const void** buffers;
+		struct ArrowArray** children;
+		struct ArrowArray* dictionary;
+		void (*release)(struct ArrowArray*);
+		void* private_data;
+	};
+}
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Statement;
+
+	///
+	/// @brief Exports statement results as Arrow C Data Interface record batches.
+	///
+	/// Each batch is a struct array with one child per output column. Column buffers are moved from a
+	/// ColumnarResult into the exported arrays without copying whenever the Firebird and Arrow layouts
+	/// match; the consumer owns the exported structures and frees them through their `release` callbacks.
+	///
+	/// Type mapping:
+	/// - `BOOLEAN` to `bool`;
+	/// - `INT16`, `INT32`, `INT64` to `int16`, `int32`, `int64`, or when scaled to `decimal128` with
+	///   precision 5, 10 or 19, as Firebird does not enforce the declared precision;
+	/// - `INT128` to `decimal128(38, scale)`; values with 39 digits are rejected with FbCppException;
+	/// - `FLOAT`, `DOUBLE` to `float32`, `float64`;
+	/// - `DATE` to `date32`;
+	/// - `TIME`, `TIME_TZ` to `time64[us]`, the latter in UTC;
+	/// - `TIMESTAMP` to `timestamp[us]` and `TIMESTAMP_TZ` to `timestamp[us, UTC]`;
+	/// - `STRING` to `utf8`, which requires an `UTF8` connection character set for non-ASCII data.
+	///
+	/// Other types (`BLOB`, `DECFLOAT`) are rejected with FbCppException.
+	///
+	class FBCPP_API ArrowExporter final
+	{
+	public:
+		///
+		/// @brief Creates an exporter that reads batches from the open cursor of the statement.
+		/// @param statement Executed statement whose result set will be exported.
+		/// @param batchRows Maximum number of rows per exported batch.
+		///
+		explicit ArrowExporter(Statement& statement, std::size_t batchRows = 65536);
+
+		ArrowExporter(const ArrowExporter&) = delete;
+		ArrowExporter& operator=(const ArrowExporter&) = delete;
+
+	public:
+		///
+		/// @brief Exports the schema of the record batches.
+		/// @param out Structure to fill; ownership passes to the caller.
+		///
+		void exportSchema(ArrowSchema* out);
+
+		///
+		/// @brief Fetches the next batch of rows and exports it.
+		/// @param out Structure to fill; ownership passes to the caller.
+		/// @return `false`, leaving `out` untouched, when the cursor is exhausted.
+		///
+		bool exportNextBatch(ArrowArray* out);
+
+		///
+		/// @brief Exports the schema matching the given output descriptors.
+		///
+		static void exportSchema(const std::vector<Descriptor>& descriptors, ArrowSchema* out);
+
+		///
+		/// @brief Exports a materialized result as a record batch, moving its buffers.
+		///
+		/// The result is left empty.
+		///
+		static void exportResult(ColumnarResult&& result, ArrowArray* out);
+
+	private:
+		Statement& statement;
+		std::size_t batchRows;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ARROW_EXPORTER_H
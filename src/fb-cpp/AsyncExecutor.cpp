@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "AsyncExecutor.h"
+#include "Statement.h"
+#include "Transaction.h"
+#include "Exception.h"
+#include <stdexcept>
+
+using namespace fbcpp;
+
+
+AsyncExecutor::AsyncExecutor(std::size_t queueCapacity, Resumer resumer)
+	: queueCapacity{queueCapacity},
+	  resumer{std::move(resumer)}
+{
+	if (queueCapacity == 0)
+		throw std::invalid_argument{"AsyncExecutor queue capacity must be greater than zero"};
+
+	worker = std::thread{&AsyncExecutor::workerLoop, this};
+}
+
+AsyncExecutor::~AsyncExecutor() noexcept
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+	}
+
+	notEmpty.notify_all();
+	notFull.notify_all();
+
+	if (worker.joinable())
+		worker.join();
+}
+
+AsyncOperation<bool> AsyncExecutor::execute(Statement& statement, Transaction& transaction)
+{
+	return submit([&statement, &transaction] { return statement.execute(transaction); });
+}
+
+AsyncOperation<bool> AsyncExecutor::fetchNext(Statement& statement)
+{
+	return submit([&statement] { return statement.fetchNext(); });
+}
+
+AsyncOperation<void> AsyncExecutor::commit(Transaction& transaction)
+{
+	return submit([&transaction] { transaction.commit(); });
+}
+
+AsyncOperation<void> AsyncExecutor::rollback(Transaction& transaction)
+{
+	return submit([&transaction] { transaction.rollback(); });
+}
+
+void AsyncExecutor::post(std::function<void()> task)
+{
+	{  // scope
+		std::unique_lock mutexGuard{mutex};
+
+		// The worker thread must never wait for itself to make room in the queue.
+		if (std::this_thread::get_id() != worker.get_id())
+			notFull.wait(mutexGuard, [this] { return queue.size() < queueCapacity || stopping; });
+
+		if (stopping && std::this_thread::get_id() != worker.get_id())
+			throw FbCppException("AsyncExecutor is stopping");
+
+		queue.push_back(std::move(task));
+	}
+
+	notEmpty.notify_one();
+}
+
+void AsyncExecutor::resume(std::coroutine_handle<> continuation)
+{
+	if (resumer)
+		resumer(continuation);
+	else
+		continuation.resume();
+}
+
+void AsyncExecutor::workerLoop()
+{
+	while (true)
+	{
+		std::function<void()> task;
+
+		{  // scope
+			std::unique_lock mutexGuard{mutex};
+			notEmpty.wait(mutexGuard, [this] { return !queue.empty() || stopping; });
+
+			if (queue.empty())
+				return;
+
+			task = std::move(queue.front());
+			queue.pop_front();
+		}
+
+		notFull.notify_one();
+
+		// Exceptions of the operations are stored in their state; the task itself does not throw.
+		task();
+	}
+}
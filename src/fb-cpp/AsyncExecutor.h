@@ -0,0 +1,267 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ASYNC_EXECUTOR_H
+#define FBCPP_ASYNC_EXECUTOR_H
+
+#include "fb-cpp_api.h"
+#include <condition_variable>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <cstddef>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class AsyncExecutor;
+	class Statement;
+	class Transaction;
+
+	///
+	/// @brief Result of an operation submitted to an AsyncExecutor.
+	///
+	/// The operation can be awaited from a C++20 coroutine with `co_await`, or waited for with get().
+	/// Exceptions thrown by the operation are rethrown to the awaiting code.
+	///
+	template <typename T>
+	class AsyncOperation final
+	{
+		friend class AsyncExecutor;
+
+	private:
+		using Value = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+		struct State final
+		{
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::optional<Value> value;
+			std::exception_ptr exception;
+			std::coroutine_handle<> continuation;
+			bool done = false;
+
+			std::coroutine_handle<> complete()
+			{
+				std::coroutine_handle<> handle;
+
+				{  // scope
+					std::lock_guard mutexGuard{mutex};
+					done = true;
+					handle = std::exchange(continuation, nullptr);
+				}
+
+				condition.notify_all();
+				return handle;
+			}
+		};
+
+	public:
+		///
+		/// @brief Reports whether the operation already completed.
+		///
+		bool await_ready() const
+		{
+			std::lock_guard mutexGuard{state->mutex};
+			return state->done;
+		}
+
+		///
+		/// @brief Registers the awaiting coroutine to be resumed when the operation completes.
+		///
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			std::lock_guard mutexGuard{state->mutex};
+
+			if (state->done)
+				return false;
+
+			state->continuation = handle;
+			return true;
+		}
+
+		///
+		/// @brief Returns the result of the completed operation or rethrows its exception.
+		///
+		T await_resume()
+		{
+			if (state->exception)
+				std::rethrow_exception(state->exception);
+
+			if constexpr (!std::is_void_v<T>)
+				return std::move(*state->value);
+		}
+
+		///
+		/// @brief Blocks the calling thread until the operation completes and returns its result.
+		///
+		/// Must not be called from the executor worker thread.
+		///
+		T get()
+		{
+			{  // scope
+				std::unique_lock mutexGuard{state->mutex};
+				state->condition.wait(mutexGuard, [this] { return state->done; });
+			}
+
+			return await_resume();
+		}
+
+	private:
+		AsyncOperation()
+			: state{std::make_shared<State>()}
+		{
+		}
+
+	private:
+		std::shared_ptr<State> state;
+	};
+
+	///
+	/// @brief Runs blocking Firebird calls on a dedicated worker thread, exposing them as awaitable operations.
+	///
+	/// Use one executor per Attachment and submit every call on that attachment and on its transactions,
+	/// statements and blobs through it: the worker thread serializes them, which respects the Firebird client
+	/// threading rules, while the submitting threads and coroutines never block on the network.
+	///
+	/// Pending operations are bounded by the queue capacity; submitting to a full queue blocks the caller,
+	/// except when it is the worker thread itself (e.g. a coroutine resumed on it), which never blocks.
+	///
+	/// By default an awaiting coroutine is resumed on the worker thread. An event loop can supply a resumer
+	/// to have coroutines resumed on its own threads instead.
+	///
+	class FBCPP_API AsyncExecutor final
+	{
+	public:
+		///
+		/// @brief Function used to resume coroutines awaiting completed operations.
+		///
+		using Resumer = std::function<void(std::coroutine_handle<>)>;
+
+	public:
+		///
+		/// @brief Starts the worker thread.
+		/// @param queueCapacity Maximum number of pending operations.
+		/// @param resumer Optional function that resumes awaiting coroutines; by default they are resumed
+		/// on the worker thread.
+		///
+		explicit AsyncExecutor(std::size_t queueCapacity = 1024, Resumer resumer = {});
+
+		AsyncExecutor(const AsyncExecutor&) = delete;
+		AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+		///
+		/// @brief Runs the pending operations and stops the worker thread.
+		///
+		~AsyncExecutor() noexcept;
+
+	public:
+		///
+		/// @brief Submits a function to run on the worker thread.
+		/// @param function Copy-constructible function to run.
+		/// @return Awaitable operation producing the function result.
+		///
+		template <typename F>
+		auto submit(F&& function) -> AsyncOperation<std::invoke_result_t<std::decay_t<F>&>>
+		{
+			using T = std::invoke_result_t<std::decay_t<F>&>;
+
+			AsyncOperation<T> operation;
+
+			post(
+				[this, state = operation.state, function = std::forward<F>(function)]() mutable
+				{
+					try
+					{
+						if constexpr (std::is_void_v<T>)
+						{
+							function();
+							state->value.emplace();
+						}
+						else
+							state->value.emplace(function());
+					}
+					catch (...)
+					{
+						state->exception = std::current_exception();
+					}
+
+					if (const auto continuation = state->complete())
+						resume(continuation);
+				});
+
+			return operation;
+		}
+
+		///
+		/// @brief Executes the statement on the worker thread. See Statement::execute().
+		///
+		AsyncOperation<bool> execute(Statement& statement, Transaction& transaction);
+
+		///
+		/// @brief Fetches the next row on the worker thread. See Statement::fetchNext().
+		///
+		AsyncOperation<bool> fetchNext(Statement& statement);
+
+		///
+		/// @brief Commits the transaction on the worker thread. See Transaction::commit().
+		///
+		AsyncOperation<void> commit(Transaction& transaction);
+
+		///
+		/// @brief Rolls back the transaction on the worker thread. See Transaction::rollback().
+		///
+		AsyncOperation<void> rollback(Transaction& transaction);
+
+	private:
+		void post(std::function<void()> task);
+		void resume(std::coroutine_handle<> continuation);
+		void workerLoop();
+
+	private:
+		const std::size_t queueCapacity;
+		const Resumer resumer;
+		std::mutex mutex;
+		std::condition_variable notEmpty;
+		std::condition_variable notFull;
+		std::deque<std::function<void()>> queue;
+		bool stopping = false;
+		std::thread worker;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ASYNC_EXECUTOR_H
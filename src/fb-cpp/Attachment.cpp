@@ -25,20 +25,29 @@
 #include "Attachment.h"
 #include "Client.h"
 #include "Exception.h"
+#include "firebird/impl/inf_pub.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
 
 
-Attachment::Attachment(Client& client, const std::string& uri, const AttachmentOptions& options)
-	: client{client},
-	  uri_{uri}
+static int toDpbInt(std::int64_t value, const char* name)
 {
-	const auto master = client.getMaster();
+	if (value < 0 || value > std::numeric_limits<int>::max())
+		throw FbCppException(std::string{"AttachmentOptions "} + name + " is out of range");
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
+	return static_cast<int>(value);
+}
 
+static FbUniquePtr<fb::IXpbBuilder> buildDpb(
+	fb::IMaster* master, StatusWrapper& statusWrapper, const AttachmentOptions& options)
+{
 	auto dpbBuilder = fbUnique(master->getUtilInterface()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::DPB,
 		reinterpret_cast<const std::uint8_t*>(options.getDpb().data()),
 		static_cast<unsigned>(options.getDpb().size())));
@@ -55,23 +64,231 @@ Attachment::Attachment(Client& client, const std::string& uri, const AttachmentO
 	if (const auto role = options.getRole())
 		dpbBuilder->insertString(&statusWrapper, isc_dpb_sql_role_name, role->c_str());
 
-	auto dispatcher = fbRef(master->getDispatcher());
+	if (const auto wireCompression = options.getWireCompression())
+	{
+		dpbBuilder->insertString(
+			&statusWrapper, isc_dpb_config, wireCompression.value() ? "WireCompression=true" : "WireCompression=false");
+	}
+
+	if (const auto pageBuffers = options.getPageBuffers())
+		dpbBuilder->insertInt(&statusWrapper, isc_dpb_num_buffers, toDpbInt(pageBuffers.value(), "page buffers"));
+
+	if (const auto parallelWorkers = options.getParallelWorkers())
+	{
+#ifdef isc_dpb_parallel_workers
+		dpbBuilder->insertInt(
+			&statusWrapper, isc_dpb_parallel_workers, toDpbInt(parallelWorkers.value(), "parallel workers"));
+#else
+		throw FbCppException("AttachmentOptions::setParallelWorkers requires Firebird 5.0 client headers");
+#endif
+	}
+
+	if (const auto statementTimeout = options.getStatementTimeout())
+	{
+		dpbBuilder->insertInt(
+			&statusWrapper, isc_dpb_statement_timeout, toDpbInt(statementTimeout->count(), "statement timeout"));
+	}
+
+	return dpbBuilder;
+}
+
+static std::uint64_t readInfoInteger(const std::uint8_t* ptr, unsigned length)
+{
+	std::uint64_t result = 0;
+
+	for (unsigned i = 0; i < length; ++i)
+		result |= static_cast<std::uint64_t>(ptr[i]) << (8u * i);
+
+	return result;
+}
+
+static TableRecordCounts& findTable(std::vector<TableRecordCounts>& tables, unsigned relationId)
+{
+	const auto pos = std::lower_bound(tables.begin(), tables.end(), relationId,
+		[](const TableRecordCounts& table, unsigned id) { return table.relationId < id; });
+
+	if (pos != tables.end() && pos->relationId == relationId)
+		return *pos;
+
+	return *tables.insert(pos, TableRecordCounts{.relationId = relationId});
+}
+
+// Returns false when the buffer was too small for the response.
+static bool parsePerformanceCounters(std::span<const std::uint8_t> buffer, PerformanceCounters& counters)
+{
+	const auto* ptr = buffer.data();
+	const auto* const end = ptr + buffer.size();
+
+	while (ptr < end)
+	{
+		const auto item = *ptr++;
+
+		if (item == isc_info_end)
+			break;
+
+		if (item == isc_info_truncated)
+			return false;
+
+		if (item == isc_info_error)
+			throw FbCppException("Attachment::getPerformanceCounters error response");
+
+		if (ptr + 2 > end)
+			throw FbCppException("Attachment::getPerformanceCounters malformed response");
+
+		const auto itemLength = static_cast<std::uint16_t>((ptr[0]) | (ptr[1] << 8));
+		ptr += 2;
+
+		if (ptr + itemLength > end)
+			throw FbCppException("Attachment::getPerformanceCounters invalid length");
+
+		switch (item)
+		{
+			case isc_info_reads:
+				counters.reads = readInfoInteger(ptr, itemLength);
+				break;
+
+			case isc_info_writes:
+				counters.writes = readInfoInteger(ptr, itemLength);
+				break;
+
+			case isc_info_fetches:
+				counters.fetches = readInfoInteger(ptr, itemLength);
+				break;
+
+			case isc_info_marks:
+				counters.marks = readInfoInteger(ptr, itemLength);
+				break;
+
+			case isc_info_read_seq_count:
+			case isc_info_read_idx_count:
+			case isc_info_insert_count:
+			case isc_info_update_count:
+			case isc_info_delete_count:
+				// Pairs of a 2-byte relation id and a 4-byte count.
+				for (auto entry = ptr; entry + 6 <= ptr + itemLength; entry += 6)
+				{
+					auto& table = findTable(counters.tables, static_cast<unsigned>(readInfoInteger(entry, 2)));
+					const auto count = readInfoInteger(entry + 2, 4);
+
+					switch (item)
+					{
+						case isc_info_read_seq_count:
+							table.sequentialReads = count;
+							break;
+
+						case isc_info_read_idx_count:
+							table.indexedReads = count;
+							break;
+
+						case isc_info_insert_count:
+							table.inserts = count;
+							break;
+
+						case isc_info_update_count:
+							table.updates = count;
+							break;
+
+						default:
+							table.deletes = count;
+							break;
+					}
+				}
+
+				break;
+
+			default:
+				break;
+		}
+
+		ptr += itemLength;
+	}
+
+	return true;
+}
+
+PerformanceCounters PerformanceCounters::since(const PerformanceCounters& before) const
+{
+	PerformanceCounters result{
+		.reads = reads - before.reads,
+		.writes = writes - before.writes,
+		.fetches = fetches - before.fetches,
+		.marks = marks - before.marks,
+	};
+
+	for (const auto& table : tables)
+	{
+		auto delta = table;
+		const auto pos = std::lower_bound(before.tables.begin(), before.tables.end(), table.relationId,
+			[](const TableRecordCounts& other, unsigned id) { return other.relationId < id; });
+
+		if (pos != before.tables.end() && pos->relationId == table.relationId)
+		{
+			delta.sequentialReads -= pos->sequentialReads;
+			delta.indexedReads -= pos->indexedReads;
+			delta.inserts -= pos->inserts;
+			delta.updates -= pos->updates;
+			delta.deletes -= pos->deletes;
+		}
+
+		if (delta.sequentialReads || delta.indexedReads || delta.inserts || delta.updates || delta.deletes)
+			result.tables.push_back(delta);
+	}
+
+	return result;
+}
+
+
+CompiledAttachmentOptions::CompiledAttachmentOptions(Client& client, const AttachmentOptions& options)
+	: createDatabase{options.getCreateDatabase()}
+{
+	const auto status = client.newStatus();
+	StatusWrapper statusWrapper{client, status.get()};
+
+	auto dpbBuilder = buildDpb(client.getMaster(), statusWrapper, options);
+	const auto dpbBuffer = dpbBuilder->getBuffer(&statusWrapper);
+	dpb.assign(dpbBuffer, dpbBuffer + dpbBuilder->getBufferLength(&statusWrapper));
+}
+
+
+Attachment::Attachment(Client& client, const std::string& uri, const AttachmentOptions& options)
+	: client{client},
+	  uri_{uri},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()},
+	  instrumentation{client.getInstrumentation()}
+{
+	auto dpbBuilder = buildDpb(client.getMaster(), statusWrapper, options);
 	const auto dpbBuffer = dpbBuilder->getBuffer(&statusWrapper);
 	const auto dpbBufferLen = dpbBuilder->getBufferLength(&statusWrapper);
 
-	if (options.getCreateDatabase())
-		handle.reset(dispatcher->createDatabase(&statusWrapper, uri.c_str(), dpbBufferLen, dpbBuffer));
+	connectOrCreate(std::span{dpbBuffer, dpbBufferLen}, options.getCreateDatabase());
+}
+
+Attachment::Attachment(Client& client, const std::string& uri, const CompiledAttachmentOptions& options)
+	: client{client},
+	  uri_{uri},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()},
+	  instrumentation{client.getInstrumentation()}
+{
+	connectOrCreate(options.getDpb(), options.getCreateDatabase());
+}
+
+void Attachment::connectOrCreate(std::span<const std::uint8_t> dpb, bool create)
+{
+	auto dispatcher = fbRef(client.getMaster()->getDispatcher());
+	const auto dpbLength = static_cast<unsigned>(dpb.size());
+
+	if (create)
+		handle.reset(dispatcher->createDatabase(&statusWrapper, uri_.c_str(), dpbLength, dpb.data()));
 	else
-		handle.reset(dispatcher->attachDatabase(&statusWrapper, uri.c_str(), dpbBufferLen, dpbBuffer));
+		handle.reset(dispatcher->attachDatabase(&statusWrapper, uri_.c_str(), dpbLength, dpb.data()));
 }
 
 void Attachment::disconnectOrDrop(bool drop)
 {
 	assert(isValid());
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
-
 	if (drop)
 		handle->dropDatabase(&statusWrapper);
 	else
@@ -81,6 +298,49 @@ void Attachment::disconnectOrDrop(bool drop)
 }
 
 
+void Attachment::ping()
+{
+	assert(isValid());
+
+	handle->ping(&statusWrapper);
+}
+
+PerformanceCounters Attachment::getPerformanceCounters()
+{
+	assert(isValid());
+
+	const std::uint8_t items[] = {
+		isc_info_reads,
+		isc_info_writes,
+		isc_info_fetches,
+		isc_info_marks,
+		isc_info_read_seq_count,
+		isc_info_read_idx_count,
+		isc_info_insert_count,
+		isc_info_update_count,
+		isc_info_delete_count,
+	};
+
+	// Per-table items grow with the number of tables used, so the buffer grows until nothing is truncated.
+	constexpr std::size_t MAX_BUFFER_SIZE = 1024 * 1024;
+	std::vector<std::uint8_t> buffer(1024);
+
+	while (true)
+	{
+		handle->getInfo(&statusWrapper, sizeof(items), items, static_cast<unsigned>(buffer.size()), buffer.data());
+
+		PerformanceCounters counters;
+
+		if (parsePerformanceCounters(buffer, counters))
+			return counters;
+
+		if (buffer.size() >= MAX_BUFFER_SIZE)
+			throw FbCppException("Attachment::getPerformanceCounters truncated response");
+
+		buffer.resize(buffer.size() * 2);
+	}
+}
+
 void Attachment::disconnect()
 {
 	disconnectOrDrop(false);
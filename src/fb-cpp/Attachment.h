@@ -29,10 +29,13 @@
 #include "fb-api.h"
 #if !FB_CPP_LEGACY_API
 #include "SmartPtrs.h"
+#include "Exception.h"
 #endif
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 #include <cstddef>
@@ -44,6 +47,7 @@
 namespace fbcpp
 {
 	class Client;
+	class Instrumentation;
 
 	///
 	/// Represents options used when creating an Attachment object.
@@ -119,6 +123,81 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Returns whether wire compression is requested for the connection.
+		///
+		const std::optional<bool>& getWireCompression() const
+		{
+			return wireCompression;
+		}
+
+		///
+		/// Sets whether the remote protocol should compress the data it sends (`WireCompression`).
+		/// Compression is used only when the server also allows it, and it reduces the transfer of
+		/// large result sets at the cost of CPU on both ends.
+		/// Not used by the Firebird 2.5 legacy API.
+		///
+		AttachmentOptions& setWireCompression(bool value)
+		{
+			wireCompression = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of page cache buffers requested for the connection.
+		///
+		const std::optional<std::uint32_t>& getPageBuffers() const
+		{
+			return pageBuffers;
+		}
+
+		///
+		/// Sets the number of page cache buffers used by the connection (`isc_dpb_num_buffers`).
+		/// It only has effect when the attachment creates the page cache, such as in embedded or
+		/// Classic/SuperClassic servers. Not used by the Firebird 2.5 legacy API.
+		///
+		AttachmentOptions& setPageBuffers(std::uint32_t value)
+		{
+			pageBuffers = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of parallel workers requested for the connection.
+		///
+		const std::optional<unsigned>& getParallelWorkers() const
+		{
+			return parallelWorkers;
+		}
+
+		///
+		/// Sets the number of parallel workers the connection may use for sweep and index creation
+		/// (Firebird 5.0+). Not used by the Firebird 2.5 legacy API.
+		///
+		AttachmentOptions& setParallelWorkers(unsigned value)
+		{
+			parallelWorkers = value;
+			return *this;
+		}
+
+		///
+		/// Returns the statement timeout requested for the connection.
+		///
+		const std::optional<std::chrono::milliseconds>& getStatementTimeout() const
+		{
+			return statementTimeout;
+		}
+
+		///
+		/// Sets the default timeout of the statements executed by the connection (Firebird 4.0+).
+		/// Zero disables it. Not used by the Firebird 2.5 legacy API.
+		///
+		AttachmentOptions& setStatementTimeout(std::chrono::milliseconds value)
+		{
+			statementTimeout = value;
+			return *this;
+		}
+
 		///
 		/// Returns the DPB (Database Parameter Block) which will be used to connect to the database.
 		///
@@ -167,14 +246,109 @@ namespace fbcpp
 		std::optional<std::string> userName;
 		std::optional<std::string> password;
 		std::optional<std::string> role;
+		std::optional<bool> wireCompression;
+		std::optional<std::uint32_t> pageBuffers;
+		std::optional<unsigned> parallelWorkers;
+		std::optional<std::chrono::milliseconds> statementTimeout;
 		std::vector<std::uint8_t> dpb;
 		bool createDatabase = false;
 	};
 
+#if !FB_CPP_LEGACY_API
+	///
+	/// AttachmentOptions serialized once into a DPB (Database Parameter Block), for connecting repeatedly
+	/// with the same options without rebuilding the block each time.
+	///
+	class FBCPP_API CompiledAttachmentOptions final
+	{
+	public:
+		///
+		/// Serializes `options` using the specified Client.
+		///
+		explicit CompiledAttachmentOptions(Client& client, const AttachmentOptions& options = {});
+
+	public:
+		///
+		/// Returns the serialized DPB.
+		///
+		const std::vector<std::uint8_t>& getDpb() const noexcept
+		{
+			return dpb;
+		}
+
+		///
+		/// Returns whether the database should be created instead of connected to.
+		///
+		bool getCreateDatabase() const noexcept
+		{
+			return createDatabase;
+		}
+
+	private:
+		std::vector<std::uint8_t> dpb;
+		bool createDatabase;
+	};
+
+	///
+	/// Record operations done by an attachment on one table.
+	///
+	struct TableRecordCounts final
+	{
+		///
+		/// Table identifier, as in `RDB$RELATIONS.RDB$RELATION_ID`.
+		///
+		unsigned relationId = 0;
+		std::uint64_t sequentialReads = 0;
+		std::uint64_t indexedReads = 0;
+		std::uint64_t inserts = 0;
+		std::uint64_t updates = 0;
+		std::uint64_t deletes = 0;
+	};
+
+	///
+	/// I/O and record counters accumulated by an attachment since it was connected, as returned by
+	/// Attachment::getPerformanceCounters().
+	/// The cost of a statement execution is the difference between the counters taken before and after it.
+	///
+	struct PerformanceCounters final
+	{
+		///
+		/// Pages read from disk.
+		///
+		std::uint64_t reads = 0;
+
+		///
+		/// Pages written to disk.
+		///
+		std::uint64_t writes = 0;
+
+		///
+		/// Pages read from the page cache.
+		///
+		std::uint64_t fetches = 0;
+
+		///
+		/// Pages changed in the page cache.
+		///
+		std::uint64_t marks = 0;
+
+		///
+		/// Per-table record counts, ordered by relation id; tables without operations are omitted.
+		///
+		std::vector<TableRecordCounts> tables;
+
+		///
+		/// Returns the counters accumulated between `before` and this snapshot.
+		///
+		PerformanceCounters since(const PerformanceCounters& before) const;
+	};
+#endif
+
 	///
 	/// Represents a connection to a Firebird database.
 	/// The Attachment must exist and remain valid while there are other objects using it, such as Transaction and
 	/// Statement.
+	/// Like Statement, it reuses one status object for its calls, so its methods must not run concurrently.
 	///
 	class FBCPP_API Attachment final
 	{
@@ -185,6 +359,14 @@ namespace fbcpp
 		///
 		explicit Attachment(Client& client, const std::string& uri, const AttachmentOptions& options = {});
 
+#if !FB_CPP_LEGACY_API
+		///
+		/// Constructs an Attachment object that connects to (or creates) the database specified by the URI
+		/// using a DPB serialized in advance.
+		///
+		explicit Attachment(Client& client, const std::string& uri, const CompiledAttachmentOptions& options);
+#endif
+
 		///
 		/// Move constructor.
 		/// A moved Attachment object becomes invalid.
@@ -197,7 +379,10 @@ namespace fbcpp
 		{
 			o.handle = 0;
 #else
-			  handle{std::move(o.handle)}
+			  status{std::move(o.status)},
+			  statusWrapper{std::move(o.statusWrapper)},
+			  handle{std::move(o.handle)},
+			  instrumentation{o.instrumentation}
 		{
 #endif
 		}
@@ -275,6 +460,37 @@ namespace fbcpp
 		{
 			return handle;
 		}
+
+		///
+		/// Returns the Instrumentation used by objects created afterwards from this Attachment, or nullptr.
+		/// It is initially the one from the Client.
+		///
+		Instrumentation* getInstrumentation() const noexcept
+		{
+			return instrumentation;
+		}
+
+		///
+		/// Sets the Instrumentation used by Statement, Transaction and Blob objects created afterwards from
+		/// this Attachment; nullptr disables it.
+		///
+		void setInstrumentation(Instrumentation* value) noexcept
+		{
+			instrumentation = value;
+		}
+#endif
+
+		///
+		/// Checks that the connection to the database is still alive with a server round-trip.
+		/// Throws an exception when the connection is broken.
+		///
+		void ping();
+
+#if !FB_CPP_LEGACY_API
+		///
+		/// Retrieves the I/O and per-table record counters of this attachment from the server.
+		///
+		PerformanceCounters getPerformanceCounters();
 #endif
 
 		///
@@ -288,6 +504,9 @@ namespace fbcpp
 		void dropDatabase();
 
 	private:
+#if !FB_CPP_LEGACY_API
+		void connectOrCreate(std::span<const std::uint8_t> dpb, bool create);
+#endif
 		void disconnectOrDrop(bool drop);
 
 	private:
@@ -296,7 +515,10 @@ namespace fbcpp
 #if FB_CPP_LEGACY_API
 		isc_db_handle handle = 0;
 #else
+		FbUniquePtr<fb::IStatus> status;
+		impl::StatusWrapper statusWrapper;
 		FbRef<fb::IAttachment> handle;
+		Instrumentation* instrumentation;
 #endif
 	};
 }  // namespace fbcpp
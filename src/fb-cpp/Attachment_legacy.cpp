@@ -102,6 +102,18 @@ void Attachment::disconnectOrDrop(bool drop)
 }
 
 
+void Attachment::ping()
+{
+	assert(isValid());
+
+	StatusVector status{};
+
+	fb_ping(status.data(), &handle);
+
+	if (hasError(status))
+		throw Exception(status, "Attachment::ping", uri_);
+}
+
 void Attachment::disconnect()
 {
 	disconnectOrDrop(false);
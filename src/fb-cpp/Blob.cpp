@@ -24,14 +24,27 @@
 
 #include "Blob.h"
 #include "Attachment.h"
+#include "BufferPool.h"
 #include "Client.h"
+#include "Instrumentation.h"
 #include "Transaction.h"
 #include "firebird/impl/inf_pub.h"
+#include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <span>
+#include <string>
+#include <system_error>
 #include <vector>
 
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 using namespace fbcpp;
 using namespace fbcpp::impl;
 
@@ -39,7 +52,8 @@ Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobOptions&
 	: attachment{attachment},
 	  transaction{transaction},
 	  status{attachment.getClient().newStatus()},
-	  statusWrapper{attachment.getClient(), status.get()}
+	  statusWrapper{attachment.getClient(), status.get()},
+	  instrumentation{attachment.getInstrumentation()}
 {
 	assert(attachment.isValid());
 	assert(transaction.isValid());
@@ -55,7 +69,8 @@ Blob::Blob(Attachment& attachment, Transaction& transaction, const BlobId& blobI
 	  transaction{transaction},
 	  id{blobId},
 	  status{attachment.getClient().newStatus()},
-	  statusWrapper{attachment.getClient(), status.get()}
+	  statusWrapper{attachment.getClient(), status.get()},
+	  instrumentation{attachment.getInstrumentation()}
 {
 	assert(attachment.isValid());
 	assert(transaction.isValid());
@@ -176,6 +191,182 @@ unsigned Blob::read(std::span<std::byte> buffer)
 	return totalRead;
 }
 
+namespace
+{
+	template <typename Container>
+	void readAllInto(Blob& blob, Container& result)
+	{
+		// The stored length is exact unless a charset transliteration changes the size.
+		auto filled = result.size();
+		result.resize(filled + blob.getLength());
+
+		while (true)
+		{
+			if (filled < result.size())
+			{
+				const auto readNow = blob.read(std::as_writable_bytes(std::span{result}.subspan(filled)));
+
+				if (readNow == 0)
+					break;
+
+				filled += readNow;
+			}
+			else
+			{
+				// Buffer is full: probe for more data without growing it for nothing.
+				std::byte probe[4096];
+				const auto readNow = blob.read(std::span{probe});
+
+				if (readNow == 0)
+					break;
+
+				const auto data = reinterpret_cast<const typename Container::value_type*>(probe);
+				result.insert(result.end(), data, data + readNow);
+				filled += readNow;
+			}
+		}
+
+		result.resize(filled);
+	}
+}  // namespace
+
+namespace
+{
+	// Largest count passed to a single read/write call; _read/_write take an unsigned int and return an int.
+	constexpr std::size_t MAX_FD_TRANSFER = static_cast<std::size_t>(std::numeric_limits<int>::max());
+
+	// Reads until the buffer is full or end of file is reached.
+	std::size_t readFd(int fd, std::span<std::byte> buffer)
+	{
+		std::size_t filled = 0;
+
+		while (filled < buffer.size())
+		{
+			const auto count = std::min(buffer.size() - filled, MAX_FD_TRANSFER);
+#ifdef _WIN32
+			const auto readNow = ::_read(fd, buffer.data() + filled, static_cast<unsigned>(count));
+#else
+			const auto readNow = ::read(fd, buffer.data() + filled, count);
+#endif
+
+			if (readNow < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				throw std::system_error{errno, std::generic_category(), "Blob::copyFrom read failed"};
+			}
+
+			if (readNow == 0)
+				break;
+
+			filled += static_cast<std::size_t>(readNow);
+		}
+
+		return filled;
+	}
+
+	// Writes the whole buffer, resuming after partial writes.
+	void writeFd(int fd, std::span<const std::byte> buffer)
+	{
+		while (!buffer.empty())
+		{
+			const auto count = std::min(buffer.size(), MAX_FD_TRANSFER);
+#ifdef _WIN32
+			const auto written = ::_write(fd, buffer.data(), static_cast<unsigned>(count));
+#else
+			const auto written = ::write(fd, buffer.data(), count);
+#endif
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+					continue;
+
+				throw std::system_error{errno, std::generic_category(), "Blob::copyTo write failed"};
+			}
+
+			buffer = buffer.subspan(static_cast<std::size_t>(written));
+		}
+	}
+}  // namespace
+
+std::vector<std::byte> Blob::readAll()
+{
+	assert(isValid());
+
+	std::vector<std::byte> result;
+	readAllInto(*this, result);
+	return result;
+}
+
+void Blob::readAll(std::string& result)
+{
+	assert(isValid());
+
+	readAllInto(*this, result);
+}
+
+std::uint64_t Blob::copyTo(int fd, const BlobCopyOptions& options)
+{
+	assert(isValid());
+
+	auto& pool = options.getBufferPool() ? *options.getBufferPool() : BufferPool::getDefault();
+	const auto buffer = pool.acquire();
+	const auto& progress = options.getProgress();
+	const std::uint64_t total = progress ? getLength() : 0;
+	std::uint64_t copied = 0;
+
+	while (true)
+	{
+		const auto readNow = read(buffer.get());
+
+		if (readNow != 0)
+		{
+			writeFd(fd, buffer.get().first(readNow));
+			copied += readNow;
+
+			if (progress)
+				progress(copied, total);
+		}
+
+		// A short read means the end of the blob was reached.
+		if (readNow < buffer.get().size())
+			break;
+	}
+
+	return copied;
+}
+
+std::uint64_t Blob::copyFrom(int fd, const BlobCopyOptions& options)
+{
+	assert(isValid());
+
+	auto& pool = options.getBufferPool() ? *options.getBufferPool() : BufferPool::getDefault();
+	const auto buffer = pool.acquire();
+	const auto& progress = options.getProgress();
+	std::uint64_t copied = 0;
+
+	while (true)
+	{
+		const auto readNow = readFd(fd, buffer.get());
+
+		if (readNow != 0)
+		{
+			write(std::span<const std::byte>{buffer.get().first(readNow)});
+			copied += readNow;
+
+			if (progress)
+				progress(copied, 0);
+		}
+
+		if (readNow < buffer.get().size())
+			break;
+	}
+
+	return copied;
+}
+
 unsigned Blob::readSegment(std::span<std::byte> buffer)
 {
 	assert(isValid());
@@ -191,6 +382,7 @@ unsigned Blob::readSegment(std::span<std::byte> buffer)
 	{
 		case fb::IStatus::RESULT_OK:
 		case fb::IStatus::RESULT_SEGMENT:
+			reportBlobTransfer(instrumentation, BlobTransfer::READ, segmentLength);
 			return segmentLength;
 
 		case fb::IStatus::RESULT_NO_DATA:
@@ -227,6 +419,7 @@ void Blob::writeSegment(std::span<const std::byte> buffer)
 		throw FbCppException("Segment too large");
 
 	handle->putSegment(&statusWrapper, static_cast<unsigned>(buffer.size()), buffer.data());
+	reportBlobTransfer(instrumentation, BlobTransfer::WRITE, buffer.size());
 }
 
 int Blob::seek(BlobSeekMode mode, int offset)
@@ -31,8 +31,10 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <span>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -43,6 +45,8 @@
 namespace fbcpp
 {
 	class Attachment;
+	class BufferPool;
+	class Instrumentation;
 	class Transaction;
 
 	///
@@ -261,6 +265,59 @@ namespace fbcpp
 		FROM_END = blb_seek_from_tail
 	};
 
+	///
+	/// Options used by Blob::copyTo() and Blob::copyFrom().
+	///
+	class BlobCopyOptions final
+	{
+	public:
+		///
+		/// Callback receiving the number of bytes copied so far and the total, or zero if it is unknown.
+		///
+		using ProgressCallback = std::function<void(std::uint64_t copied, std::uint64_t total)>;
+
+	public:
+		///
+		/// Retrieves the pool the transfer buffer is taken from.
+		/// A null value means BufferPool::getDefault().
+		///
+		BufferPool* getBufferPool() const noexcept
+		{
+			return bufferPool;
+		}
+
+		///
+		/// Sets the pool the transfer buffer is taken from.
+		///
+		BlobCopyOptions& setBufferPool(BufferPool* value) noexcept
+		{
+			bufferPool = value;
+			return *this;
+		}
+
+		///
+		/// Retrieves the progress callback.
+		///
+		const ProgressCallback& getProgress() const noexcept
+		{
+			return progress;
+		}
+
+		///
+		/// Sets a callback invoked after each buffer is transferred.
+		/// Exceptions thrown by it abort the copy and are propagated.
+		///
+		BlobCopyOptions& setProgress(ProgressCallback value)
+		{
+			progress = std::move(value);
+			return *this;
+		}
+
+	private:
+		BufferPool* bufferPool = nullptr;
+		ProgressCallback progress;
+	};
+
 	///
 	/// Provides read and write access to Firebird blobs.
 	///
@@ -286,7 +343,8 @@ namespace fbcpp
 			  id{o.id},
 			  status{std::move(o.status)},
 			  statusWrapper{std::move(o.statusWrapper)},
-			  handle{std::move(o.handle)}
+			  handle{std::move(o.handle)},
+			  instrumentation{o.instrumentation}
 		{
 		}
 
@@ -366,6 +424,33 @@ namespace fbcpp
 			return read(std::as_writable_bytes(buffer));
 		}
 
+		///
+		/// Reads the remaining content of the blob.
+		/// The result is preallocated from getLength(), so a large blob is read without reallocations.
+		///
+		std::vector<std::byte> readAll();
+
+		///
+		/// Appends the remaining content of the blob to `result`, preallocating it from getLength().
+		///
+		void readAll(std::string& result);
+
+		///
+		/// @brief Writes the remaining content of the blob to a file descriptor, such as a file or a socket.
+		/// Data goes through one pooled buffer filled with as many segments as fit, and is written with
+		/// a single call per buffer, so memory use is bounded by the buffer size.
+		/// @return The number of bytes copied.
+		/// @throws std::system_error if writing to `fd` fails.
+		///
+		std::uint64_t copyTo(int fd, const BlobCopyOptions& options = {});
+
+		///
+		/// @brief Appends the content read from a file descriptor until end of file to the blob.
+		/// @return The number of bytes copied.
+		/// @throws std::system_error if reading from `fd` fails.
+		///
+		std::uint64_t copyFrom(int fd, const BlobCopyOptions& options = {});
+
 		///
 		/// Reads a single segment from the blob into the provided buffer.
 		///
@@ -430,6 +515,7 @@ namespace fbcpp
 		FbUniquePtr<fb::IStatus> status;
 		impl::StatusWrapper statusWrapper;
 		FbRef<fb::IBlob> handle;
+		Instrumentation* instrumentation;
 	};
 }  // namespace fbcpp
 
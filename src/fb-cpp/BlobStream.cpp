@@ -0,0 +1,362 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BlobStream.h"
+#include "Exception.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+using namespace fbcpp;
+
+
+BlobStreamBuffer::BlobStreamBuffer(Blob& blob, std::ios_base::openmode mode, std::size_t bufferSize)
+	: blob{blob},
+	  mode{mode & (std::ios_base::in | std::ios_base::out)}
+{
+	if (this->mode != std::ios_base::in && this->mode != std::ios_base::out)
+		throw std::invalid_argument{"BlobStreamBuffer mode must be either std::ios_base::in or std::ios_base::out"};
+
+	if (bufferSize == 0)
+		throw std::invalid_argument{"BlobStreamBuffer buffer size must be greater than zero"};
+
+	buffer.resize(bufferSize);
+
+	if (this->mode == std::ios_base::out)
+		setp(buffer.data(), buffer.data() + buffer.size());
+	else
+		setg(buffer.data(), buffer.data(), buffer.data());
+}
+
+BlobStreamBuffer::~BlobStreamBuffer()
+{
+	if (mode == std::ios_base::out && blob.isValid())
+	{
+		try
+		{
+			flushOutput();
+		}
+		catch (...)
+		{
+			// swallow
+		}
+	}
+}
+
+BlobStreamBuffer::int_type BlobStreamBuffer::underflow()
+{
+	if (mode != std::ios_base::in || !blob.isValid())
+		return traits_type::eof();
+
+	if (gptr() < egptr())
+		return traits_type::to_int_type(*gptr());
+
+	const auto readNow = blob.read(std::span<char>{buffer});
+
+	if (readNow == 0)
+		return traits_type::eof();
+
+	inputEnd += readNow;
+	setg(buffer.data(), buffer.data(), buffer.data() + readNow);
+
+	return traits_type::to_int_type(*gptr());
+}
+
+std::streamsize BlobStreamBuffer::xsgetn(char_type* data, std::streamsize count)
+{
+	const auto buffered = std::min<std::streamsize>(egptr() - gptr(), count);
+
+	if (buffered > 0)
+	{
+		std::memcpy(data, gptr(), static_cast<std::size_t>(buffered));
+		gbump(static_cast<int>(buffered));
+	}
+
+	auto total = buffered;
+
+	// Large reads go straight into the caller's memory instead of through the buffer.
+	while (mode == std::ios_base::in && blob.isValid() && count - total >= static_cast<std::streamsize>(buffer.size()))
+	{
+		const auto chunk = std::min<std::streamsize>(count - total, std::numeric_limits<int>::max());
+		const auto readNow = blob.read(std::span<char>{data + total, static_cast<std::size_t>(chunk)});
+
+		inputEnd += readNow;
+		total += readNow;
+		setg(buffer.data(), buffer.data(), buffer.data());
+
+		if (readNow < chunk)
+			return total;
+	}
+
+	if (total < count)
+		total += std::streambuf::xsgetn(data + total, count - total);
+
+	return total;
+}
+
+BlobStreamBuffer::int_type BlobStreamBuffer::overflow(int_type ch)
+{
+	if (mode != std::ios_base::out || !flushOutput())
+		return traits_type::eof();
+
+	if (!traits_type::eq_int_type(ch, traits_type::eof()))
+	{
+		*pptr() = traits_type::to_char_type(ch);
+		pbump(1);
+	}
+
+	return traits_type::not_eof(ch);
+}
+
+std::streamsize BlobStreamBuffer::xsputn(const char_type* data, std::streamsize count)
+{
+	if (mode != std::ios_base::out)
+		return 0;
+
+	// Large writes skip the buffer once what it already holds was sent.
+	if (count >= static_cast<std::streamsize>(buffer.size()))
+	{
+		if (!flushOutput())
+			return 0;
+
+		blob.write(std::span<const char>{data, static_cast<std::size_t>(count)});
+		return count;
+	}
+
+	return std::streambuf::xsputn(data, count);
+}
+
+int BlobStreamBuffer::sync()
+{
+	if (mode == std::ios_base::out)
+		return flushOutput() ? 0 : -1;
+
+	return 0;
+}
+
+BlobStreamBuffer::pos_type BlobStreamBuffer::seekoff(
+	off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which)
+{
+	const auto failed = pos_type(off_type(-1));
+
+	if (mode != std::ios_base::in || !(which & std::ios_base::in) || !blob.isValid())
+		return failed;
+
+	const auto current = inputEnd - (egptr() - gptr());
+	off_type target;
+
+	switch (direction)
+	{
+		case std::ios_base::beg:
+			target = offset;
+			break;
+
+		case std::ios_base::cur:
+			target = current + offset;
+			break;
+
+		case std::ios_base::end:
+		{
+			if (offset > 0 || offset < std::numeric_limits<int>::min())
+				return failed;
+
+			setg(buffer.data(), buffer.data(), buffer.data());
+			inputEnd = blob.seek(BlobSeekMode::FROM_END, static_cast<int>(offset));
+			return pos_type(inputEnd);
+		}
+
+		default:
+			return failed;
+	}
+
+	// Stay inside the buffered data when possible.
+	const auto bufferStart = inputEnd - (egptr() - eback());
+
+	if (target >= bufferStart && target <= inputEnd)
+	{
+		setg(eback(), eback() + (target - bufferStart), egptr());
+		return pos_type(target);
+	}
+
+	if (target < 0 || target > std::numeric_limits<int>::max())
+		return failed;
+
+	setg(buffer.data(), buffer.data(), buffer.data());
+	inputEnd = blob.seek(BlobSeekMode::FROM_BEGIN, static_cast<int>(target));
+
+	return pos_type(inputEnd);
+}
+
+BlobStreamBuffer::pos_type BlobStreamBuffer::seekpos(pos_type position, std::ios_base::openmode which)
+{
+	return seekoff(off_type(position), std::ios_base::beg, which);
+}
+
+bool BlobStreamBuffer::flushOutput()
+{
+	if (!blob.isValid())
+		return false;
+
+	if (const auto pending = pptr() - pbase(); pending > 0)
+	{
+		blob.write(std::span<const char>{pbase(), static_cast<std::size_t>(pending)});
+		setp(buffer.data(), buffer.data() + buffer.size());
+	}
+
+	return true;
+}
+
+
+BlobWriter::BlobWriter(Blob& blob, std::size_t bufferSize)
+	: blob{blob},
+	  bufferSize{bufferSize}
+{
+	if (bufferSize == 0)
+		throw std::invalid_argument{"BlobWriter buffer size must be greater than zero"};
+
+	filling.reserve(bufferSize);
+	sending.reserve(bufferSize);
+
+	worker = std::thread{&BlobWriter::workerLoop, this};
+}
+
+BlobWriter::~BlobWriter() noexcept
+{
+	stop();
+}
+
+void BlobWriter::write(std::span<const std::byte> data)
+{
+	if (stopping)
+		throw FbCppException("BlobWriter is already finished");
+
+	while (!data.empty())
+	{
+		const auto count = std::min(bufferSize - filling.size(), data.size());
+		filling.insert(filling.end(), data.begin(), data.begin() + static_cast<std::ptrdiff_t>(count));
+		data = data.subspan(count);
+
+		if (filling.size() == bufferSize)
+			submit();
+	}
+}
+
+void BlobWriter::finish()
+{
+	if (stopping)
+		return;
+
+	if (!filling.empty())
+		submit();
+
+	{  // scope
+		std::unique_lock mutexGuard{mutex};
+		condition.wait(mutexGuard, [this] { return !sendPending; });
+	}
+
+	stop();
+
+	if (error)
+		std::rethrow_exception(error);
+}
+
+std::uint64_t BlobWriter::getBytesWritten() const
+{
+	std::lock_guard mutexGuard{mutex};
+	return bytesWritten;
+}
+
+void BlobWriter::submit()
+{
+	{  // scope
+		std::unique_lock mutexGuard{mutex};
+		condition.wait(mutexGuard, [this] { return !sendPending; });
+
+		if (error)
+			std::rethrow_exception(error);
+
+		std::swap(filling, sending);
+		sendPending = true;
+	}
+
+	condition.notify_all();
+	filling.clear();
+}
+
+void BlobWriter::stop() noexcept
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+	}
+
+	condition.notify_all();
+
+	if (worker.joinable())
+		worker.join();
+}
+
+void BlobWriter::workerLoop()
+{
+	std::unique_lock mutexGuard{mutex};
+
+	while (true)
+	{
+		condition.wait(mutexGuard, [this] { return sendPending || stopping; });
+
+		if (!sendPending)
+			break;
+
+		// After a failure the remaining buffers are dropped; the producer sees the error.
+		const bool failed = error != nullptr;
+		std::exception_ptr writeError;
+
+		mutexGuard.unlock();
+
+		if (!failed)
+		{
+			try
+			{
+				blob.write(std::span<const std::byte>{sending});
+			}
+			catch (...)
+			{
+				writeError = std::current_exception();
+			}
+		}
+
+		mutexGuard.lock();
+
+		if (writeError)
+			error = writeError;
+		else if (!failed)
+			bytesWritten += sending.size();
+
+		sendPending = false;
+		condition.notify_all();
+	}
+}
@@ -0,0 +1,217 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BLOB_STREAM_H
+#define FBCPP_BLOB_STREAM_H
+
+#include "fb-cpp_api.h"
+#include "Blob.h"
+#include <condition_variable>
+#include <exception>
+#include <ios>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <span>
+#include <streambuf>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief std::streambuf over an open Blob, for either reading or writing.
+	///
+	/// Reads fill the buffer with as many segments as fit, so the blob is read ahead by the buffer size.
+	/// Writes are accumulated and sent when the buffer is full or on flush. Transfers larger than the buffer
+	/// go directly between the blob and the caller's memory.
+	///
+	/// Seeking is supported on input, through Blob::seek(), which requires a stream blob.
+	///
+	class FBCPP_API BlobStreamBuffer final : public std::streambuf
+	{
+	public:
+		///
+		/// Default buffer size: a few maximum-size segments.
+		///
+		static constexpr std::size_t DEFAULT_BUFFER_SIZE = 4 * 65535;
+
+	public:
+		///
+		/// @brief Creates a buffer over `blob`.
+		/// @param mode `std::ios_base::in` to read the blob or `std::ios_base::out` to write it.
+		/// @throws std::invalid_argument if `mode` is not exactly one of in and out, or bufferSize is zero.
+		///
+		explicit BlobStreamBuffer(
+			Blob& blob, std::ios_base::openmode mode, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+		///
+		/// Flushes pending output, ignoring errors. Call `pubsync()` first to see them.
+		///
+		~BlobStreamBuffer() override;
+
+		BlobStreamBuffer(const BlobStreamBuffer&) = delete;
+		BlobStreamBuffer& operator=(const BlobStreamBuffer&) = delete;
+
+	protected:
+		int_type underflow() override;
+		std::streamsize xsgetn(char_type* data, std::streamsize count) override;
+		int_type overflow(int_type ch) override;
+		std::streamsize xsputn(const char_type* data, std::streamsize count) override;
+		int sync() override;
+		pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode which) override;
+		pos_type seekpos(pos_type position, std::ios_base::openmode which) override;
+
+	private:
+		bool flushOutput();
+
+	private:
+		Blob& blob;
+		std::ios_base::openmode mode;
+		std::vector<char> buffer;
+		// Blob position of the end of the data in the get area.
+		std::streamoff inputEnd = 0;
+	};
+
+	///
+	/// @brief std::istream reading a Blob through a BlobStreamBuffer.
+	///
+	class FBCPP_API BlobInputStream final : public std::istream
+	{
+	public:
+		explicit BlobInputStream(Blob& blob, std::size_t bufferSize = BlobStreamBuffer::DEFAULT_BUFFER_SIZE)
+			: std::istream{nullptr},
+			  buffer{blob, std::ios_base::in, bufferSize}
+		{
+			rdbuf(&buffer);
+		}
+
+	private:
+		BlobStreamBuffer buffer;
+	};
+
+	///
+	/// @brief std::ostream writing a Blob through a BlobStreamBuffer.
+	///
+	class FBCPP_API BlobOutputStream final : public std::ostream
+	{
+	public:
+		explicit BlobOutputStream(Blob& blob, std::size_t bufferSize = BlobStreamBuffer::DEFAULT_BUFFER_SIZE)
+			: std::ostream{nullptr},
+			  buffer{blob, std::ios_base::out, bufferSize}
+		{
+			rdbuf(&buffer);
+		}
+
+	private:
+		BlobStreamBuffer buffer;
+	};
+
+	///
+	/// @brief Writes a blob from a background thread while the producer fills the next buffer.
+	///
+	/// Data is collected into one of two buffers. When it is full, it is handed to a worker thread that sends
+	/// it with Blob::write() while the producer fills the other one, so the network and the producer work in
+	/// parallel. The producer only waits when it fills a buffer before the previous one was sent.
+	///
+	/// The blob must not be used by other code until finish() returns. finish() does not close the blob.
+	///
+	class FBCPP_API BlobWriter final
+	{
+	public:
+		///
+		/// Default size of each of the two buffers.
+		///
+		static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+	public:
+		///
+		/// @brief Starts the worker thread.
+		/// @throws std::invalid_argument if bufferSize is zero.
+		///
+		explicit BlobWriter(Blob& blob, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+		///
+		/// Stops the worker thread. Data not yet handed to finish() is discarded.
+		///
+		~BlobWriter() noexcept;
+
+		BlobWriter(const BlobWriter&) = delete;
+		BlobWriter& operator=(const BlobWriter&) = delete;
+
+	public:
+		///
+		/// @brief Appends data to the blob.
+		/// @throws The exception raised by an earlier background write, if any.
+		///
+		void write(std::span<const std::byte> data);
+
+		///
+		/// @brief Appends data to the blob.
+		///
+		void write(std::span<const char> data)
+		{
+			write(std::as_bytes(data));
+		}
+
+		///
+		/// @brief Sends the remaining data and waits until everything was written.
+		/// @throws The exception raised by a background write, if any.
+		///
+		void finish();
+
+		///
+		/// @brief Returns the number of bytes already written to the blob.
+		///
+		std::uint64_t getBytesWritten() const;
+
+	private:
+		void submit();
+		void stop() noexcept;
+		void workerLoop();
+
+	private:
+		Blob& blob;
+		const std::size_t bufferSize;
+		std::vector<std::byte> filling;
+		std::vector<std::byte> sending;
+		mutable std::mutex mutex;
+		std::condition_variable condition;
+		bool sendPending = false;
+		bool stopping = false;
+		std::uint64_t bytesWritten = 0;
+		std::exception_ptr error;
+		std::thread worker;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BLOB_STREAM_H
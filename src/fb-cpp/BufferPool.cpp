@@ -0,0 +1,96 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "BufferPool.h"
+#include <new>
+#include <stdexcept>
+
+using namespace fbcpp;
+
+
+PooledBuffer::~PooledBuffer() noexcept
+{
+	if (pool)
+		pool->release(data);
+}
+
+BufferPool::BufferPool(std::size_t bufferSize, std::size_t maxIdle)
+	: bufferSize{bufferSize},
+	  maxIdle{maxIdle}
+{
+	if (bufferSize == 0)
+		throw std::invalid_argument{"BufferPool buffer size must be greater than zero"};
+}
+
+BufferPool::~BufferPool() noexcept
+{
+	for (auto* data : idle)
+		::operator delete(data, std::align_val_t{ALIGNMENT});
+}
+
+BufferPool& BufferPool::getDefault()
+{
+	static BufferPool pool;
+	return pool;
+}
+
+PooledBuffer BufferPool::acquire()
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		if (!idle.empty())
+		{
+			auto* const data = idle.back();
+			idle.pop_back();
+			return PooledBuffer{*this, data, bufferSize};
+		}
+	}
+
+	auto* const data = static_cast<std::byte*>(::operator new(bufferSize, std::align_val_t{ALIGNMENT}));
+	return PooledBuffer{*this, data, bufferSize};
+}
+
+void BufferPool::release(std::byte* data) noexcept
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		if (idle.size() < maxIdle)
+		{
+			try
+			{
+				idle.push_back(data);
+				return;
+			}
+			catch (...)
+			{
+				// fall through and free it
+			}
+		}
+	}
+
+	::operator delete(data, std::align_val_t{ALIGNMENT});
+}
@@ -0,0 +1,169 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_BUFFER_POOL_H
+#define FBCPP_BUFFER_POOL_H
+
+#include "fb-cpp_api.h"
+#include <mutex>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class BufferPool;
+
+	///
+	/// @brief Buffer borrowed from a BufferPool; returns it to the pool when destroyed.
+	///
+	class FBCPP_API PooledBuffer final
+	{
+		friend class BufferPool;
+
+	private:
+		explicit PooledBuffer(BufferPool& pool, std::byte* data, std::size_t size) noexcept
+			: pool{&pool},
+			  data{data},
+			  size{size}
+		{
+		}
+
+	public:
+		///
+		/// Transfers the buffer from another instance.
+		///
+		PooledBuffer(PooledBuffer&& o) noexcept
+			: pool{o.pool},
+			  data{o.data},
+			  size{o.size}
+		{
+			o.pool = nullptr;
+			o.data = nullptr;
+			o.size = 0;
+		}
+
+		PooledBuffer& operator=(PooledBuffer&&) = delete;
+		PooledBuffer(const PooledBuffer&) = delete;
+		PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+		///
+		/// Returns the buffer to its pool.
+		///
+		~PooledBuffer() noexcept;
+
+	public:
+		///
+		/// Returns the buffer memory.
+		///
+		std::span<std::byte> get() const noexcept
+		{
+			return {data, size};
+		}
+
+	private:
+		BufferPool* pool;
+		std::byte* data;
+		std::size_t size;
+	};
+
+	///
+	/// @brief Thread-safe pool of equally-sized, page-aligned buffers for bulk I/O.
+	///
+	/// Buffers are allocated on demand and up to `maxIdle` of them are kept for reuse after being returned.
+	/// The alignment makes them suitable for file descriptors opened with O_DIRECT.
+	/// The pool must outlive every PooledBuffer acquired from it.
+	///
+	class FBCPP_API BufferPool final
+	{
+		friend class PooledBuffer;
+
+	public:
+		///
+		/// Alignment of every buffer.
+		///
+		static constexpr std::size_t ALIGNMENT = 4096;
+
+		///
+		/// Default buffer size.
+		///
+		static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1024 * 1024;
+
+		///
+		/// Default number of idle buffers kept for reuse.
+		///
+		static constexpr std::size_t DEFAULT_MAX_IDLE = 4;
+
+	public:
+		///
+		/// @brief Creates an empty pool.
+		/// @throws std::invalid_argument if bufferSize is zero.
+		///
+		explicit BufferPool(std::size_t bufferSize = DEFAULT_BUFFER_SIZE, std::size_t maxIdle = DEFAULT_MAX_IDLE);
+
+		///
+		/// Frees the idle buffers.
+		///
+		~BufferPool() noexcept;
+
+		BufferPool(const BufferPool&) = delete;
+		BufferPool& operator=(const BufferPool&) = delete;
+
+	public:
+		///
+		/// Returns a process-wide pool with the default settings.
+		///
+		static BufferPool& getDefault();
+
+		///
+		/// Returns the size of the buffers of this pool.
+		///
+		std::size_t getBufferSize() const noexcept
+		{
+			return bufferSize;
+		}
+
+		///
+		/// Borrows an idle buffer, or allocates a new one if none is available.
+		///
+		PooledBuffer acquire();
+
+	private:
+		void release(std::byte* data) noexcept;
+
+	private:
+		const std::size_t bufferSize;
+		const std::size_t maxIdle;
+		std::mutex mutex;
+		std::vector<std::byte*> idle;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_BUFFER_POOL_H
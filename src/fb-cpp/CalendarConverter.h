@@ -33,9 +33,13 @@
 #include <array>
 #include <charconv>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <format>
-#include <regex>
+#include <iterator>
+#include <ratio>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -44,77 +48,279 @@
 
 namespace fbcpp::impl
 {
-	// FIXME: review methods
-	class CalendarConverter final
+	///
+	/// Single-pass scanner over the textual date and time formats accepted by CalendarConverter.
+	/// Whitespace is the same set matched by `\s`: space, tab, line feed, vertical tab, form feed and carriage return.
+	///
+	class CalendarScanner final
 	{
 	public:
-		explicit CalendarConverter(Client& client, StatusWrapper* statusWrapper)
-			: client{client},
-			  statusWrapper{statusWrapper}
+		struct DateParts final
+		{
+			int year;
+			unsigned month;
+			unsigned day;
+		};
+
+		struct TimeParts final
+		{
+			unsigned hours;
+			unsigned minutes;
+			unsigned seconds;
+			unsigned fractions;  // In 1/10000 of a second.
+		};
+
+	public:
+		explicit constexpr CalendarScanner(std::string_view text) noexcept
+			: current{text.data()},
+			  end{text.data() + text.size()}
 		{
 		}
 
 	public:
-		OpaqueDate dateToOpaqueDate(const Date& date)
+		static constexpr bool isSpace(char c) noexcept
 		{
-			if (!date.ok())
-				throwInvalidDateValue();
+			return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+		}
 
-			const auto yearValue = static_cast<unsigned>(static_cast<int>(date.year()));
-			const auto monthValue = static_cast<unsigned>(date.month());
-			const auto dayValue = static_cast<unsigned>(date.day());
+		static constexpr bool isDigit(char c) noexcept
+		{
+			return c >= '0' && c <= '9';
+		}
 
-			if (yearValue <= 0)
-				throwInvalidDateValue();
+		constexpr bool atEnd() const noexcept
+		{
+			return current == end;
+		}
 
-			return OpaqueDate{client.getUtil()->encodeDate(static_cast<unsigned>(yearValue), monthValue, dayValue)};
+		// \s*
+		constexpr void skipSpaces() noexcept
+		{
+			while (current != end && isSpace(*current))
+				++current;
 		}
 
-		Date opaqueDateToDate(OpaqueDate date)
+		// \s+
+		constexpr bool requireSpaces() noexcept
+		{
+			if (current == end || !isSpace(*current))
+				return false;
+
+			skipSpaces();
+			return true;
+		}
+
+		// \s*$
+		constexpr bool finish() noexcept
+		{
+			skipSpaces();
+			return atEnd();
+		}
+
+		// \s*<c>\s*
+		constexpr bool separator(char c) noexcept
+		{
+			skipSpaces();
+
+			if (current == end || *current != c)
+				return false;
+
+			++current;
+			skipSpaces();
+			return true;
+		}
+
+		// [0-9]{count}
+		constexpr bool digits(unsigned count, unsigned& result) noexcept
+		{
+			if (static_cast<std::size_t>(end - current) < count)
+				return false;
+
+			result = 0;
+
+			for (unsigned i = 0; i < count; ++i, ++current)
+			{
+				if (!isDigit(*current))
+					return false;
+
+				result = result * 10 + static_cast<unsigned>(*current - '0');
+			}
+
+			return true;
+		}
+
+		// [^\s]+
+		constexpr bool token(std::string_view& result) noexcept
+		{
+			const auto start = current;
+
+			while (current != end && !isSpace(*current))
+				++current;
+
+			result = std::string_view{start, static_cast<std::size_t>(current - start)};
+			return !result.empty();
+		}
+
+		// \s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})
+		constexpr bool date(DateParts& result) noexcept
 		{
 			unsigned year;
-			unsigned month;
-			unsigned day;
 
-			client.getUtil()->decodeDate(date.value, &year, &month, &day);
+			skipSpaces();
 
-			return Date{std::chrono::year{static_cast<int>(year)}, std::chrono::month{month}, std::chrono::day{day}};
+			if (!digits(4, year) || !separator('-') || !digits(2, result.month) || !separator('-') ||
+				!digits(2, result.day))
+			{
+				return false;
+			}
+
+			result.year = static_cast<int>(year);
+			return true;
 		}
 
-		Date stringToDate(std::string_view value)
+		// \s*([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?
+		// With allowFraction = false, the optional group is not consumed, as when a regex backtracks over it.
+		constexpr bool time(TimeParts& result, bool allowFraction = true) noexcept
 		{
-			static const std::regex pattern(R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s*$)");
+			skipSpaces();
 
-			const std::string stringValue{value};
+			if (!digits(2, result.hours) || !separator(':') || !digits(2, result.minutes) || !separator(':') ||
+				!digits(2, result.seconds))
+			{
+				return false;
+			}
 
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
+			result.fractions = 0;
+
+			const auto beforeFraction = current;
+			skipSpaces();
 
-			const auto makeComponentView = [&](const std::size_t index)
+			if (!allowFraction || current == end || *current != '.')
 			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
+				// No fraction: leave the whitespace to the caller.
+				current = beforeFraction;
+				return true;
+			}
+
+			++current;
+			skipSpaces();
+
+			unsigned count = 0;
 
-			const auto parseComponent = [&](const std::size_t index)
+			while (current != end && isDigit(*current) && count < 4)
 			{
-				int result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
+				result.fractions = result.fractions * 10 + static_cast<unsigned>(*current - '0');
+				++current;
+				++count;
+			}
 
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
+			if (count == 0 || (current != end && isDigit(*current)))
+				return false;
 
-				return result;
-			};
+			for (; count < 4; ++count)
+				result.fractions *= 10;
+
+			return true;
+		}
+
+	private:
+		const char* current;
+		const char* end;
+	};
+
+	// FIXME: review methods
+	class CalendarConverter final
+	{
+	public:
+		explicit CalendarConverter(Client& client, StatusWrapper* statusWrapper)
+			: client{client},
+			  statusWrapper{statusWrapper}
+		{
+		}
+
+	public:
+		///
+		/// Encodes a valid date as the number of days since 1858-11-17, the ISC_DATE format.
+		/// Does the same proleptic Gregorian arithmetic as IUtil::encodeDate without calling into fbclient.
+		///
+		static constexpr ISC_DATE encodeDate(const Date& date) noexcept
+		{
+			return static_cast<ISC_DATE>((std::chrono::local_days{date} - BASE_EPOCH).count());
+		}
+
+		///
+		/// Decodes an ISC_DATE day count. Inverse of encodeDate().
+		///
+		static constexpr Date decodeDate(ISC_DATE date) noexcept
+		{
+			return Date{BASE_EPOCH + std::chrono::days{date}};
+		}
+
+		///
+		/// Encodes a time of day as the number of 1/10000 seconds since midnight, the ISC_TIME format.
+		/// Sub-units below 100 microseconds are truncated, as with IUtil::encodeTime.
+		///
+		static constexpr ISC_TIME encodeTime(const Time& time) noexcept
+		{
+			return static_cast<ISC_TIME>(std::chrono::duration_cast<Ticks>(time.to_duration()).count());
+		}
+
+		///
+		/// Decodes an ISC_TIME tick count. Inverse of encodeTime().
+		///
+		static constexpr Time decodeTime(ISC_TIME time) noexcept
+		{
+			return Time{std::chrono::duration_cast<std::chrono::microseconds>(Ticks{time})};
+		}
+
+	public:
+		OpaqueDate dateToOpaqueDate(const Date& date)
+		{
+			if (!date.ok() || static_cast<int>(date.year()) <= 0)
+				throwInvalidDateValue();
+
+			return OpaqueDate{encodeDate(date)};
+		}
+
+		Date opaqueDateToDate(OpaqueDate date)
+		{
+			return decodeDate(date.value);
+		}
+
+		///
+		/// Converts each date of `source` into the element at the same index of `destination`.
+		/// Both spans must have the same size.
+		///
+		void datesToOpaqueDates(std::span<const Date> source, std::span<OpaqueDate> destination)
+		{
+			checkBatchSizes(source.size(), destination.size());
+
+			for (std::size_t i = 0; i < source.size(); ++i)
+				destination[i] = dateToOpaqueDate(source[i]);
+		}
+
+		///
+		/// Converts each opaque date of `source` into the element at the same index of `destination`.
+		/// Both spans must have the same size.
+		///
+		void opaqueDatesToDates(std::span<const OpaqueDate> source, std::span<Date> destination)
+		{
+			checkBatchSizes(source.size(), destination.size());
+
+			for (std::size_t i = 0; i < source.size(); ++i)
+				destination[i] = decodeDate(source[i].value);
+		}
+
+		Date stringToDate(std::string_view value)
+		{
+			CalendarScanner scanner{value};
+			CalendarScanner::DateParts parts;
 
-			const int year = parseComponent(1);
-			const unsigned month = static_cast<unsigned>(parseComponent(2));
-			const unsigned day = static_cast<unsigned>(parseComponent(3));
+			if (!scanner.date(parts) || !scanner.finish())
+				throwConversionErrorFromString(std::string{value});
 
-			const Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+			const Date date{
+				std::chrono::year{parts.year}, std::chrono::month{parts.month}, std::chrono::day{parts.day}};
 
 			if (!date.ok())
 				throwInvalidDateValue();
@@ -129,7 +335,17 @@ namespace fbcpp::impl
 
 		std::string opaqueDateToString(OpaqueDate date)
 		{
-			return std::format("{:%Y-%m-%d}", std::chrono::local_days{opaqueDateToDate(date)});
+			std::string result;
+			opaqueDateToString(date, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a date to `result`.
+		///
+		void opaqueDateToString(OpaqueDate date, std::string& result)
+		{
+			std::format_to(std::back_inserter(result), "{:%Y-%m-%d}", std::chrono::local_days{opaqueDateToDate(date)});
 		}
 
 		OpaqueTime timeToOpaqueTime(const Time& time)
@@ -140,85 +356,28 @@ namespace fbcpp::impl
 			const auto subseconds = static_cast<unsigned>(time.subseconds().count() / 100);
 
 			OpaqueTime opaqueTime;
-			opaqueTime.value = client.getUtil()->encodeTime(hours, minutes, seconds, subseconds);
+			opaqueTime.value = ((hours * 60 + minutes) * 60 + seconds) * TICKS_PER_SECOND + subseconds;
 
 			return opaqueTime;
 		}
 
 		Time opaqueTimeToTime(OpaqueTime time)
 		{
-			unsigned hours;
-			unsigned minutes;
-			unsigned seconds;
-			unsigned subseconds;
-
-			const auto util = client.getUtil();
-			util->decodeTime(time.value, &hours, &minutes, &seconds, &subseconds);
-
-			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
-				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(subseconds) * 100};
-
-			return Time{timeOfDay};
+			return decodeTime(time.value);
 		}
 
 		Time stringToTime(std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s*$)");
-
-			const std::string stringValue{value};
+			CalendarScanner scanner{value};
+			CalendarScanner::TimeParts parts;
 
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
+			if (!scanner.time(parts) || !scanner.finish())
 				throwConversionErrorFromString(std::string{value});
 
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const auto hours = parseComponent(1);
-			const auto minutes = parseComponent(2);
-			const auto seconds = parseComponent(3);
-
-			unsigned fractions = 0;
-			if (matches[4].matched && matches.length(4) > 0)
-			{
-				const auto fractionComponent = makeComponentView(4);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
-
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
-
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
-			}
-
-			if (hours >= 24 || minutes >= 60 || seconds >= 60)
-				throwInvalidTimeValue();
-
-			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
-				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(fractions) * 100};
-
-			if (timeOfDay >= std::chrono::hours{24})
+			if (parts.hours >= 24 || parts.minutes >= 60 || parts.seconds >= 60)
 				throwInvalidTimeValue();
 
-			return Time{std::chrono::duration_cast<std::chrono::microseconds>(timeOfDay)};
+			return Time{partsToTimeOfDay(parts)};
 		}
 
 		OpaqueTime stringToOpaqueTime(std::string_view value)
@@ -227,13 +386,23 @@ namespace fbcpp::impl
 		}
 
 		std::string opaqueTimeToString(OpaqueTime time)
+		{
+			std::string result;
+			opaqueTimeToString(time, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a time of day to `result`.
+		///
+		void opaqueTimeToString(OpaqueTime time, std::string& result)
 		{
 			const auto converted = opaqueTimeToTime(time);
 			const auto subseconds = static_cast<unsigned>(converted.subseconds().count() / 100);
 
-			return std::format("{:02}:{:02}:{:02}.{:04}", static_cast<unsigned>(converted.hours().count()),
-				static_cast<unsigned>(converted.minutes().count()), static_cast<unsigned>(converted.seconds().count()),
-				subseconds);
+			std::format_to(std::back_inserter(result), "{:02}:{:02}:{:02}.{:04}",
+				static_cast<unsigned>(converted.hours().count()), static_cast<unsigned>(converted.minutes().count()),
+				static_cast<unsigned>(converted.seconds().count()), subseconds);
 		}
 
 		OpaqueTimeTz timeTzToOpaqueTimeTz(const TimeTz& timeTz)
@@ -288,6 +457,16 @@ namespace fbcpp::impl
 		}
 
 		std::string opaqueTimeTzToString(const OpaqueTimeTz& time)
+		{
+			std::string result;
+			opaqueTimeTzToString(time, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a time of day with time zone to `result`.
+		///
+		void opaqueTimeTzToString(const OpaqueTimeTz& time, std::string& result)
 		{
 			unsigned hours;
 			unsigned minutes;
@@ -298,70 +477,33 @@ namespace fbcpp::impl
 			client.getUtil()->decodeTimeTz(statusWrapper, &time.value, &hours, &minutes, &seconds, &fractions,
 				static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
 
-			return std::format("{:02}:{:02}:{:02}.{:04} {}", hours, minutes, seconds, fractions, timeZoneBuffer.data());
+			std::format_to(std::back_inserter(result), "{:02}:{:02}:{:02}.{:04} {}", hours, minutes, seconds, fractions,
+				timeZoneBuffer.data());
 		}
 
 		TimeTz stringToTimeTz(std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s+([^\s]+)\s*$)");
-
-			const std::string stringValue{value};
+			CalendarScanner::TimeParts parts;
+			std::string_view timeZone;
 
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
-
-			const auto makeComponentView = [&](const std::size_t index)
+			const auto scan = [&](bool allowFraction)
 			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
+				CalendarScanner scanner{value};
+				return scanner.time(parts, allowFraction) && scanner.requireSpaces() && scanner.token(timeZone) &&
+					scanner.finish();
 			};
 
-			const auto hours = parseComponent(1);
-			const auto minutes = parseComponent(2);
-			const auto seconds = parseComponent(3);
-
-			unsigned fractions = 0;
-			if (matches[4].matched && matches.length(4) > 0)
-			{
-				const auto fractionComponent = makeComponentView(4);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
-
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
-
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
-			}
-
-			if (hours >= 24 || minutes >= 60 || seconds >= 60)
-				throwInvalidTimeValue();
-
-			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
-				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(fractions) * 100};
+			// A fraction-like text may still be matched as the time zone, e.g. "10:00:00 .5".
+			if (!scan(true) && !scan(false))
+				throwConversionErrorFromString(std::string{value});
 
-			if (timeOfDay >= std::chrono::hours{24})
+			if (parts.hours >= 24 || parts.minutes >= 60 || parts.seconds >= 60)
 				throwInvalidTimeValue();
 
 			OpaqueTimeTz encoded;
-			const std::string timeZoneString{makeComponentView(5)};
-			client.getUtil()->encodeTimeTz(
-				statusWrapper, &encoded.value, hours, minutes, seconds, fractions, timeZoneString.c_str());
+			const std::string timeZoneString{timeZone};
+			client.getUtil()->encodeTimeTz(statusWrapper, &encoded.value, parts.hours, parts.minutes, parts.seconds,
+				parts.fractions, timeZoneString.c_str());
 
 			return opaqueTimeTzToTimeTz(encoded);
 		}
@@ -388,106 +530,64 @@ namespace fbcpp::impl
 
 			OpaqueTimestamp opaqueTimestamp;
 			opaqueTimestamp.value.timestamp_date = opaqueDate.value;
-			opaqueTimestamp.value.timestamp_time =
-				client.getUtil()->encodeTime(static_cast<unsigned>(timestamp.time.hours().count()),
-					static_cast<unsigned>(timestamp.time.minutes().count()),
-					static_cast<unsigned>(timestamp.time.seconds().count()), static_cast<unsigned>(subseconds / 100));
+			opaqueTimestamp.value.timestamp_time = encodeTime(timestamp.time);
 
 			return opaqueTimestamp;
 		}
 
 		Timestamp opaqueTimestampToTimestamp(OpaqueTimestamp timestamp)
 		{
-			unsigned year;
-			unsigned month;
-			unsigned day;
-			unsigned hours;
-			unsigned minutes;
-			unsigned seconds;
-			unsigned subseconds;
-
-			const auto util = client.getUtil();
-			util->decodeDate(timestamp.value.timestamp_date, &year, &month, &day);
-			util->decodeTime(timestamp.value.timestamp_time, &hours, &minutes, &seconds, &subseconds);
-
-			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
-				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(subseconds) * 100};
-
-			const Date date{
-				std::chrono::year{static_cast<int>(year)}, std::chrono::month{month}, std::chrono::day{day}};
+			const auto date = decodeDate(timestamp.value.timestamp_date);
 
 			if (!date.ok())
 				throwInvalidTimestampValue();
 
-			return Timestamp{date, Time{timeOfDay}};
+			return Timestamp{date, decodeTime(timestamp.value.timestamp_time)};
 		}
 
-		Timestamp stringToTimestamp(std::string_view value)
+		///
+		/// Converts each timestamp of `source` into the element at the same index of `destination`.
+		/// Both spans must have the same size.
+		///
+		void timestampsToOpaqueTimestamps(std::span<const Timestamp> source, std::span<OpaqueTimestamp> destination)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s+([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s*$)");
-
-			const std::string stringValue{value};
-
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
-
-			const auto makeComponentView = [&](const std::size_t index)
-			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
-			};
-
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
+			checkBatchSizes(source.size(), destination.size());
 
-				return result;
-			};
+			for (std::size_t i = 0; i < source.size(); ++i)
+				destination[i] = timestampToOpaqueTimestamp(source[i]);
+		}
 
-			const int year = static_cast<int>(parseComponent(1));
-			const unsigned month = parseComponent(2);
-			const unsigned day = parseComponent(3);
-			const auto hours = parseComponent(4);
-			const auto minutes = parseComponent(5);
-			const auto seconds = parseComponent(6);
+		///
+		/// Converts each opaque timestamp of `source` into the element at the same index of `destination`.
+		/// Both spans must have the same size.
+		///
+		void opaqueTimestampsToTimestamps(std::span<const OpaqueTimestamp> source, std::span<Timestamp> destination)
+		{
+			checkBatchSizes(source.size(), destination.size());
 
-			unsigned fractions = 0;
-			if (matches[7].matched && matches.length(7) > 0)
-			{
-				const auto fractionComponent = makeComponentView(7);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
+			for (std::size_t i = 0; i < source.size(); ++i)
+				destination[i] = opaqueTimestampToTimestamp(source[i]);
+		}
 
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
+		Timestamp stringToTimestamp(std::string_view value)
+		{
+			CalendarScanner scanner{value};
+			CalendarScanner::DateParts dateParts;
+			CalendarScanner::TimeParts timeParts;
 
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
-			}
+			if (!scanner.date(dateParts) || !scanner.requireSpaces() || !scanner.time(timeParts) || !scanner.finish())
+				throwConversionErrorFromString(std::string{value});
 
-			const Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+			const Date date{std::chrono::year{dateParts.year}, std::chrono::month{dateParts.month},
+				std::chrono::day{dateParts.day}};
 
 			if (!date.ok())
 				throwInvalidTimestampValue();
 
-			if (hours >= 24 || minutes >= 60 || seconds >= 60)
-				throwInvalidTimestampValue();
-
-			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
-				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(fractions) * 100};
-
-			if (timeOfDay >= std::chrono::hours{24})
+			if (timeParts.hours >= 24 || timeParts.minutes >= 60 || timeParts.seconds >= 60)
 				throwInvalidTimestampValue();
 
-			return Timestamp{date, Time{timeOfDay}};
+			return Timestamp{date, Time{partsToTimeOfDay(timeParts)}};
 		}
 
 		OpaqueTimestamp stringToOpaqueTimestamp(std::string_view value)
@@ -496,17 +596,24 @@ namespace fbcpp::impl
 		}
 
 		std::string opaqueTimestampToString(OpaqueTimestamp timestamp)
+		{
+			std::string result;
+			opaqueTimestampToString(timestamp, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a timestamp to `result`.
+		///
+		void opaqueTimestampToString(OpaqueTimestamp timestamp, std::string& result)
 		{
 			const auto converted = opaqueTimestampToTimestamp(timestamp);
 			const auto subseconds = static_cast<unsigned>(converted.time.subseconds().count() / 100);
 
-			const auto dateString = std::format("{:%Y-%m-%d}", std::chrono::local_days{converted.date});
-			const auto timeString =
-				std::format("{:02}:{:02}:{:02}.{:04}", static_cast<unsigned>(converted.time.hours().count()),
-					static_cast<unsigned>(converted.time.minutes().count()),
-					static_cast<unsigned>(converted.time.seconds().count()), subseconds);
-
-			return std::format("{} {}", dateString, timeString);
+			std::format_to(std::back_inserter(result), "{:%Y-%m-%d} {:02}:{:02}:{:02}.{:04}",
+				std::chrono::local_days{converted.date}, static_cast<unsigned>(converted.time.hours().count()),
+				static_cast<unsigned>(converted.time.minutes().count()),
+				static_cast<unsigned>(converted.time.seconds().count()), subseconds);
 		}
 
 		OpaqueTimestampTz timestampTzToOpaqueTimestampTz(const TimestampTz& timestampTz)
@@ -559,6 +666,16 @@ namespace fbcpp::impl
 		}
 
 		std::string opaqueTimestampTzToString(const OpaqueTimestampTz& timestamp)
+		{
+			std::string result;
+			opaqueTimestampTzToString(timestamp, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a timestamp with time zone to `result`.
+		///
+		void opaqueTimestampTzToString(const OpaqueTimestampTz& timestamp, std::string& result)
 		{
 			unsigned year;
 			unsigned month;
@@ -572,85 +689,43 @@ namespace fbcpp::impl
 			client.getUtil()->decodeTimeStampTz(statusWrapper, &timestamp.value, &year, &month, &day, &hours, &minutes,
 				&seconds, &subseconds, static_cast<unsigned>(timeZoneBuffer.size()), timeZoneBuffer.data());
 
-			return std::format("{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:04} {}", year, month, day, hours, minutes,
-				seconds, subseconds, timeZoneBuffer.data());
+			std::format_to(std::back_inserter(result), "{:04}-{:02}-{:02} {:02}:{:02}:{:02}.{:04} {}", year, month, day,
+				hours, minutes, seconds, subseconds, timeZoneBuffer.data());
 		}
 
 		TimestampTz stringToTimestampTz(std::string_view value)
 		{
-			static const std::regex pattern(
-				R"(^\s*([0-9]{4})\s*-\s*([0-9]{2})\s*-\s*([0-9]{2})\s+([0-9]{2})\s*:\s*([0-9]{2})\s*:\s*([0-9]{2})(?:\s*\.\s*([0-9]{1,4}))?\s+([^\s]+)\s*$)");
+			CalendarScanner::DateParts dateParts;
+			CalendarScanner::TimeParts timeParts;
+			std::string_view timeZone;
 
-			const std::string stringValue{value};
-
-			std::smatch matches;
-			if (!std::regex_match(stringValue, matches, pattern))
-				throwConversionErrorFromString(std::string{value});
-
-			const auto makeComponentView = [&](const std::size_t index)
+			const auto scan = [&](bool allowFraction)
 			{
-				return std::string_view{stringValue.data() + static_cast<std::size_t>(matches.position(index)),
-					static_cast<std::size_t>(matches.length(index))};
+				CalendarScanner scanner{value};
+				return scanner.date(dateParts) && scanner.requireSpaces() && scanner.time(timeParts, allowFraction) &&
+					scanner.requireSpaces() && scanner.token(timeZone) && scanner.finish();
 			};
 
-			const auto parseComponent = [&](const std::size_t index)
-			{
-				unsigned result;
-				const auto component = makeComponentView(index);
-				const auto [ptr, ec] =
-					std::from_chars(component.data(), component.data() + component.size(), result, 10);
-
-				if (ec != std::errc{} || ptr != component.data() + component.size())
-					throwConversionErrorFromString(std::string{value});
-
-				return result;
-			};
-
-			const int year = static_cast<int>(parseComponent(1));
-			const unsigned month = parseComponent(2);
-			const unsigned day = parseComponent(3);
-			const auto hours = parseComponent(4);
-			const auto minutes = parseComponent(5);
-			const auto seconds = parseComponent(6);
-
-			unsigned fractions = 0;
-			if (matches[7].matched && matches.length(7) > 0)
-			{
-				const auto fractionComponent = makeComponentView(7);
-				const auto [ptr, ec] = std::from_chars(
-					fractionComponent.data(), fractionComponent.data() + fractionComponent.size(), fractions, 10);
-
-				if (ec != std::errc{} || ptr != fractionComponent.data() + fractionComponent.size())
-					throwConversionErrorFromString(std::string{value});
-
-				for (auto remaining = 4 - static_cast<int>(fractionComponent.size()); remaining > 0; --remaining)
-					fractions *= 10;
-			}
+			// A fraction-like text may still be matched as the time zone, e.g. "2024-01-01 10:00:00 .5".
+			if (!scan(true) && !scan(false))
+				throwConversionErrorFromString(std::string{value});
 
-			const Date date{std::chrono::year{year}, std::chrono::month{month}, std::chrono::day{day}};
+			const Date date{std::chrono::year{dateParts.year}, std::chrono::month{dateParts.month},
+				std::chrono::day{dateParts.day}};
 
 			if (!date.ok())
 				throwInvalidTimestampValue();
 
-			if (hours >= 24 || minutes >= 60 || seconds >= 60)
+			if (timeParts.hours >= 24 || timeParts.minutes >= 60 || timeParts.seconds >= 60)
 				throwInvalidTimestampValue();
 
-			const auto timeOfDay = std::chrono::hours{hours} + std::chrono::minutes{minutes} +
-				std::chrono::seconds{seconds} + std::chrono::microseconds{static_cast<std::int64_t>(fractions) * 100};
-
-			if (timeOfDay >= std::chrono::hours{24})
-				throwInvalidTimestampValue();
-
-			const Timestamp localTimestamp{date, Time{timeOfDay}};
-
-			const auto monthValue = static_cast<unsigned>(date.month());
-			const auto dayValue = static_cast<unsigned>(date.day());
+			const Timestamp localTimestamp{date, Time{partsToTimeOfDay(timeParts)}};
 
 			OpaqueTimestampTz encoded;
-			const std::string timeZoneString{makeComponentView(8)};
-			client.getUtil()->encodeTimeStampTz(statusWrapper, &encoded.value,
-				static_cast<unsigned>(static_cast<int>(date.year())), monthValue, dayValue, hours, minutes, seconds,
-				fractions, timeZoneString.c_str());
+			const std::string timeZoneString{timeZone};
+			client.getUtil()->encodeTimeStampTz(statusWrapper, &encoded.value, static_cast<unsigned>(dateParts.year),
+				dateParts.month, dateParts.day, timeParts.hours, timeParts.minutes, timeParts.seconds,
+				timeParts.fractions, timeZoneString.c_str());
 
 			const OpaqueTimestamp utcOpaque{encoded.value.utc_timestamp};
 			const auto utcTimestamp = opaqueTimestampToTimestamp(utcOpaque);
@@ -666,6 +741,13 @@ namespace fbcpp::impl
 		}
 
 	private:
+		static std::chrono::microseconds partsToTimeOfDay(const CalendarScanner::TimeParts& parts) noexcept
+		{
+			return std::chrono::hours{parts.hours} + std::chrono::minutes{parts.minutes} +
+				std::chrono::seconds{parts.seconds} +
+				std::chrono::microseconds{static_cast<std::int64_t>(parts.fractions) * 100};
+		}
+
 		[[noreturn]] void throwConversionErrorFromString(const std::string& str)
 		{
 			const std::intptr_t STATUS_CONVERSION_ERROR_FROM_STRING[] = {
@@ -677,6 +759,12 @@ namespace fbcpp::impl
 			throw DatabaseException(client, STATUS_CONVERSION_ERROR_FROM_STRING);
 		}
 
+		static void checkBatchSizes(std::size_t sourceSize, std::size_t destinationSize)
+		{
+			if (sourceSize != destinationSize)
+				throw std::invalid_argument{"Source and destination spans must have the same size"};
+		}
+
 		[[noreturn]] void throwInvalidDateValue()
 		{
 			static constexpr std::intptr_t STATUS_INVALID_DATE_VALUE[] = {
@@ -708,7 +796,10 @@ namespace fbcpp::impl
 		}
 
 	private:
-		static constexpr auto TICKS_PER_DAY = std::int64_t{24} * 60 * 60 * 10000;
+		using Ticks = std::chrono::duration<std::int64_t, std::ratio<1, 10000>>;
+
+		static constexpr unsigned TICKS_PER_SECOND = 10000;
+		static constexpr auto TICKS_PER_DAY = std::int64_t{24} * 60 * 60 * TICKS_PER_SECOND;
 		static constexpr auto BASE_EPOCH = std::chrono::local_days{
 			std::chrono::year{1858} / std::chrono::November / 17,
 		};
@@ -45,6 +45,8 @@
 ///
 namespace fbcpp
 {
+	class Instrumentation;
+
 	///
 	/// Represents a Firebird client library instance.
 	/// The Client must exist and remain valid while there are other objects using it, such as Attachment, Transaction
@@ -97,7 +99,8 @@ namespace fbcpp
 			  util{o.util},
 			  int128Util{o.int128Util},
 			  decFloat16Util{o.decFloat16Util},
-			  decFloat34Util{o.decFloat34Util}
+			  decFloat34Util{o.decFloat34Util},
+			  instrumentation{o.instrumentation}
 #if FB_CPP_USE_BOOST_DLL != 0
 			  ,
 			  fbclientLib{std::move(o.fbclientLib)}
@@ -108,6 +111,7 @@ namespace fbcpp
 			o.int128Util = nullptr;
 			o.decFloat16Util = nullptr;
 			o.decFloat34Util = nullptr;
+			o.instrumentation = nullptr;
 		}
 
 		///
@@ -203,6 +207,23 @@ namespace fbcpp
 			return fbUnique(master->getStatus());
 		}
 
+		///
+		/// Returns the Instrumentation used by attachments created afterwards, or nullptr.
+		///
+		Instrumentation* getInstrumentation() const noexcept
+		{
+			return instrumentation;
+		}
+
+		///
+		/// Sets the Instrumentation used by attachments created afterwards; nullptr disables it.
+		/// Existing attachments keep the one they were created with.
+		///
+		void setInstrumentation(Instrumentation* value) noexcept
+		{
+			instrumentation = value;
+		}
+
 		///
 		/// Shuts down the Firebird client library (or embedded engine) instance.
 		///
@@ -214,6 +235,7 @@ namespace fbcpp
 		fb::IInt128* int128Util = nullptr;
 		fb::IDecFloat16* decFloat16Util = nullptr;
 		fb::IDecFloat34* decFloat34Util = nullptr;
+		Instrumentation* instrumentation = nullptr;
 #if FB_CPP_USE_BOOST_DLL != 0
 		boost::dll::shared_library fbclientLib;
 #endif
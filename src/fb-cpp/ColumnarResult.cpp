@@ -0,0 +1,156 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ColumnarResult.h"
+#include "Statement.h"
+#include <algorithm>
+
+using namespace fbcpp;
+
+
+void ColumnarColumn::reserve(std::size_t rows)
+{
+	validity.reserve((rows + 7u) / 8u);
+
+	if (isString())
+		offsets.reserve(rows + 1u);
+	else
+		values.reserve(rows * valueSize);
+}
+
+void ColumnarColumn::append(const std::byte* message)
+{
+	const bool null = *reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE;
+
+	// Append the value first, so a failure leaves the row count, validity and offsets consistent.
+	if (isString())
+	{
+		if (!null)
+		{
+			const auto length = *reinterpret_cast<const std::uint16_t*>(&message[descriptor.offset]);
+			const auto data = reinterpret_cast<const char*>(&message[descriptor.offset + sizeof(std::uint16_t)]);
+
+			if (stringData.size() + length > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+				throw FbCppException("String column data exceeds 2 GB");
+
+			stringData.insert(stringData.end(), data, data + length);
+		}
+
+		offsets.push_back(static_cast<std::int32_t>(stringData.size()));
+	}
+	else if (null)
+		values.resize(values.size() + valueSize);
+	else
+	{
+		const auto data = &message[descriptor.offset];
+		values.insert(values.end(), data, data + valueSize);
+	}
+
+	const auto row = rowCount++;
+
+	if (row % 8u == 0u)
+		validity.push_back(0u);
+
+	if (null)
+		++nullCount;
+	else
+		validity.back() |= static_cast<std::uint8_t>(1u << (row % 8u));
+}
+
+void ColumnarColumn::clear() noexcept
+{
+	rowCount = 0;
+	nullCount = 0;
+	validity.clear();
+	values.clear();
+	stringData.clear();
+
+	if (isString())
+	{
+		offsets.clear();
+		offsets.push_back(0);
+	}
+}
+
+
+ColumnarResult::ColumnarResult(Statement& statement)
+{
+	const auto& descriptors = statement.getOutputDescriptors();
+	columns.reserve(descriptors.size());
+
+	for (const auto& descriptor : descriptors)
+		columns.emplace_back(descriptor);
+}
+
+std::vector<ColumnarColumn> ColumnarResult::releaseColumns() noexcept
+{
+	rowCount = 0;
+	return std::move(columns);
+}
+
+void ColumnarResult::reserve(std::size_t rows)
+{
+	for (auto& column : columns)
+		column.reserve(rows);
+}
+
+void ColumnarResult::clear() noexcept
+{
+	rowCount = 0;
+
+	for (auto& column : columns)
+		column.clear();
+}
+
+void ColumnarResult::appendRow(RowView row)
+{
+	const auto message = row.getMessage();
+
+	for (auto& column : columns)
+		column.append(message);
+
+	++rowCount;
+}
+
+std::size_t ColumnarResult::drain(Statement& statement, std::size_t maxRows)
+{
+	std::size_t appended = 0;
+
+	while (appended < maxRows)
+	{
+		const auto remaining = std::min<std::size_t>(maxRows - appended, std::numeric_limits<unsigned>::max());
+		const auto block = statement.fetchBlock(static_cast<unsigned>(remaining));
+
+		if (block.empty())
+			break;
+
+		for (const auto row : block)
+			appendRow(row);
+
+		appended += block.size();
+	}
+
+	return appended;
+}
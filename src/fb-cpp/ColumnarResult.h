@@ -0,0 +1,301 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_COLUMNAR_RESULT_H
+#define FBCPP_COLUMNAR_RESULT_H
+
+#include "fb-cpp_api.h"
+#include "Descriptor.h"
+#include "Exception.h"
+#include <format>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class RowView;
+	class Statement;
+
+	///
+	/// @brief Values of a single result column stored contiguously.
+	///
+	/// Fixed-size values are stored in their native message representation, one after the other.
+	/// String values are stored as `rowCount + 1` offsets into a shared character buffer.
+	/// Nulls are tracked in a validity bitmap where bit `i % 8` of byte `i / 8` is set for non-null rows,
+	/// and the value slot of a null row is zero-filled.
+	///
+	class ColumnarColumn final
+	{
+		friend class ColumnarResult;
+		friend class ArrowExporter;
+
+	public:
+		///
+		/// @brief Creates an empty column for the given output descriptor.
+		///
+		explicit ColumnarColumn(const Descriptor& descriptor)
+			: descriptor{descriptor},
+			  valueSize{descriptor.adjustedType == DescriptorAdjustedType::STRING ? 0u : descriptor.length}
+		{
+			if (isString())
+				offsets.push_back(0);
+		}
+
+	public:
+		///
+		/// @brief Returns the descriptor of the statement column this column was built from.
+		///
+		const Descriptor& getDescriptor() const noexcept
+		{
+			return descriptor;
+		}
+
+		///
+		/// @brief Reports whether the column stores variable-length strings.
+		///
+		bool isString() const noexcept
+		{
+			return valueSize == 0u;
+		}
+
+		///
+		/// @brief Returns the size in bytes of each fixed-size value; zero for string columns.
+		///
+		unsigned getValueSize() const noexcept
+		{
+			return valueSize;
+		}
+
+		///
+		/// @brief Returns the number of rows stored in the column.
+		///
+		std::size_t getRowCount() const noexcept
+		{
+			return rowCount;
+		}
+
+		///
+		/// @brief Returns the number of null rows stored in the column.
+		///
+		std::size_t getNullCount() const noexcept
+		{
+			return nullCount;
+		}
+
+		///
+		/// @brief Reports whether the given row is null.
+		///
+		bool isNull(std::size_t row) const noexcept
+		{
+			return (validity[row / 8u] & (1u << (row % 8u))) == 0u;
+		}
+
+		///
+		/// @brief Returns the validity bitmap, one bit per row, set for non-null rows.
+		///
+		std::span<const std::uint8_t> getValidity() const noexcept
+		{
+			return validity;
+		}
+
+		///
+		/// @brief Returns the raw fixed-size values of all rows.
+		///
+		std::span<const std::byte> getValueData() const noexcept
+		{
+			return values;
+		}
+
+		///
+		/// @brief Returns the fixed-size values of all rows viewed as `T`.
+		///
+		/// `T` must match the native representation of the column, e.g. `std::int32_t` for `INT32`,
+		/// `double` for `DOUBLE` or `OpaqueTimestamp` for `TIMESTAMP`.
+		///
+		template <typename T>
+		std::span<const T> getValues() const
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			if (isString() || sizeof(T) != valueSize)
+			{
+				throw FbCppException(std::format(
+					"Cannot read column of {} bytes as a type of {} bytes", valueSize, sizeof(T)));
+			}
+
+			return {reinterpret_cast<const T*>(values.data()), rowCount};
+		}
+
+		///
+		/// @brief Returns the string stored at the given row of a string column.
+		///
+		std::string_view getString(std::size_t row) const
+		{
+			if (!isString())
+				throw FbCppException("Column does not store strings");
+
+			if (row >= rowCount)
+				throw std::out_of_range("row out of range");
+
+			return {stringData.data() + offsets[row], static_cast<std::size_t>(offsets[row + 1] - offsets[row])};
+		}
+
+		///
+		/// @brief Returns the `rowCount + 1` offsets delimiting each row in the string buffer.
+		///
+		std::span<const std::int32_t> getOffsets() const noexcept
+		{
+			return offsets;
+		}
+
+		///
+		/// @brief Returns the buffer holding the characters of all rows of a string column.
+		///
+		std::span<const char> getStringData() const noexcept
+		{
+			return stringData;
+		}
+
+	private:
+		void reserve(std::size_t rows);
+		void append(const std::byte* message);
+		void clear() noexcept;
+
+	private:
+		Descriptor descriptor;
+		unsigned valueSize;
+		std::size_t rowCount = 0;
+		std::size_t nullCount = 0;
+		std::vector<std::uint8_t> validity;
+		std::vector<std::byte> values;
+		std::vector<std::int32_t> offsets;
+		std::vector<char> stringData;
+	};
+
+	///
+	/// @brief Materializes statement result rows into per-column contiguous storage.
+	///
+	/// Columns are laid out as described by the statement output descriptors at construction time,
+	/// so a result can be reused with clear() for successive chunks of the same statement.
+	///
+	class FBCPP_API ColumnarResult final
+	{
+	public:
+		///
+		/// @brief Creates an empty result shaped after the output columns of the statement.
+		///
+		explicit ColumnarResult(Statement& statement);
+
+		ColumnarResult(ColumnarResult&&) noexcept = default;
+		ColumnarResult& operator=(ColumnarResult&&) noexcept = default;
+		ColumnarResult(const ColumnarResult&) = delete;
+		ColumnarResult& operator=(const ColumnarResult&) = delete;
+
+	public:
+		///
+		/// @brief Returns the number of rows stored.
+		///
+		std::size_t getRowCount() const noexcept
+		{
+			return rowCount;
+		}
+
+		///
+		/// @brief Returns the number of columns.
+		///
+		unsigned getColumnCount() const noexcept
+		{
+			return static_cast<unsigned>(columns.size());
+		}
+
+		///
+		/// @brief Returns the column at the given index.
+		///
+		const ColumnarColumn& getColumn(unsigned index) const
+		{
+			if (index >= columns.size())
+				throw std::out_of_range("index out of range");
+
+			return columns[index];
+		}
+
+		///
+		/// @brief Returns all columns.
+		///
+		const std::vector<ColumnarColumn>& getColumns() const noexcept
+		{
+			return columns;
+		}
+
+		///
+		/// @brief Moves the columns out of the result, leaving it empty.
+		///
+		std::vector<ColumnarColumn> releaseColumns() noexcept;
+
+		///
+		/// @brief Reserves storage for the given number of rows in every column.
+		///
+		void reserve(std::size_t rows);
+
+		///
+		/// @brief Removes all rows while keeping the allocated storage.
+		///
+		void clear() noexcept;
+
+		///
+		/// @brief Appends a row fetched by the statement this result was created from.
+		///
+		void appendRow(RowView row);
+
+		///
+		/// @brief Fetches rows from the open cursor of the statement and appends them.
+		///
+		/// Rows are fetched with Statement::fetchBlock(), so the row already fetched by Statement::execute()
+		/// is included when no cursor movement happened after it.
+		///
+		/// @param statement Statement this result was created from, with an open cursor.
+		/// @param maxRows Maximum number of rows to append.
+		/// @return Number of rows appended; less than `maxRows` only when the cursor is exhausted.
+		///
+		std::size_t drain(Statement& statement, std::size_t maxRows = std::numeric_limits<std::size_t>::max());
+
+	private:
+		std::vector<ColumnarColumn> columns;
+		std::size_t rowCount = 0;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_COLUMNAR_RESULT_H
@@ -0,0 +1,288 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ConnectionPool.h"
+#include "Client.h"
+#include "Exception.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <format>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace fbcpp;
+
+
+AttachmentLease::~AttachmentLease() noexcept
+{
+	if (pool && attachment)
+		pool->release(std::move(attachment), broken);
+}
+
+
+ConnectionPool::ConnectionPool(Client& client, const std::string& uri, const ConnectionPoolOptions& options)
+	: client{client},
+	  uri{uri},
+	  options{options},
+	  attachmentOptions{client, options.getAttachmentOptions()}
+{
+	if (options.getMaxSize() == 0)
+		throw std::invalid_argument{"ConnectionPool maximum size must be greater than zero"};
+
+	if (options.getMinIdle() > options.getMaxIdle() || options.getMaxIdle() > options.getMaxSize())
+		throw std::invalid_argument{"ConnectionPool sizes must satisfy minIdle <= maxIdle <= maxSize"};
+
+	if (options.getAttachmentOptions().getCreateDatabase())
+		throw std::invalid_argument{"ConnectionPool cannot create databases"};
+
+	const auto warmupCount = std::min(std::max(options.getWarmup(), options.getMinIdle()), options.getMaxIdle());
+	const auto now = std::chrono::steady_clock::now();
+
+	for (std::size_t i = 0; i < warmupCount; ++i)
+		idle.push_back(IdleConnection{connect(), now});
+
+	stats.created = warmupCount;
+	stats.idle = idle.size();
+
+	reaper = std::thread{&ConnectionPool::reaperLoop, this};
+}
+
+ConnectionPool::~ConnectionPool() noexcept
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+		stopping = true;
+	}
+
+	reaperWakeup.notify_all();
+
+	if (reaper.joinable())
+		reaper.join();
+
+	assert(stats.leased == 0);
+
+	// Attachment destructors disconnect and swallow errors.
+	idle.clear();
+}
+
+AttachmentLease ConnectionPool::acquire(std::chrono::milliseconds timeout)
+{
+	const auto start = std::chrono::steady_clock::now();
+	const auto deadline = start + timeout;
+
+	std::unique_lock mutexGuard{mutex};
+
+	while (true)
+	{
+		if (!idle.empty())
+		{
+			auto attachment = std::move(idle.back().attachment);
+			idle.pop_back();
+			++stats.leased;
+			stats.idle = idle.size();
+
+			if (options.getValidateOnAcquire())
+			{
+				mutexGuard.unlock();
+
+				bool alive = true;
+
+				try
+				{
+					attachment->ping();
+				}
+				catch (...)
+				{
+					alive = false;
+					attachment.reset();
+				}
+
+				mutexGuard.lock();
+
+				if (!alive)
+				{
+					--stats.leased;
+					++stats.validationFailures;
+					++stats.destroyed;
+					continue;
+				}
+			}
+
+			++stats.acquired;
+			recordWait(std::chrono::steady_clock::now() - start);
+
+			return AttachmentLease{this, std::move(attachment)};
+		}
+
+		if (stats.leased + idle.size() + opening < options.getMaxSize())
+		{
+			++opening;
+			mutexGuard.unlock();
+
+			std::unique_ptr<Attachment> attachment;
+
+			try
+			{
+				attachment = connect();
+			}
+			catch (...)
+			{
+				mutexGuard.lock();
+				--opening;
+				mutexGuard.unlock();
+				available.notify_one();
+				throw;
+			}
+
+			mutexGuard.lock();
+			--opening;
+			++stats.created;
+			++stats.leased;
+			++stats.acquired;
+			recordWait(std::chrono::steady_clock::now() - start);
+
+			return AttachmentLease{this, std::move(attachment)};
+		}
+
+		if (available.wait_until(mutexGuard, deadline) == std::cv_status::timeout &&
+			std::chrono::steady_clock::now() >= deadline)
+		{
+			++stats.timeouts;
+			throw FbCppException(
+				std::format("Timed out after {} waiting for a connection from the pool of '{}'", timeout, uri));
+		}
+	}
+}
+
+ConnectionPoolStats ConnectionPool::getStats() const
+{
+	std::lock_guard mutexGuard{mutex};
+	return stats;
+}
+
+std::unique_ptr<Attachment> ConnectionPool::connect()
+{
+	return std::make_unique<Attachment>(client, uri, attachmentOptions);
+}
+
+void ConnectionPool::release(std::unique_ptr<Attachment> attachment, bool broken) noexcept
+{
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		--stats.leased;
+
+		if (!broken && attachment->isValid() && idle.size() < options.getMaxIdle())
+		{
+			try
+			{
+				idle.push_back(IdleConnection{std::move(attachment), std::chrono::steady_clock::now()});
+			}
+			catch (...)
+			{
+				// Out of memory: the connection was closed with the temporary entry.
+				++stats.destroyed;
+			}
+
+			stats.idle = idle.size();
+		}
+		else
+			++stats.destroyed;
+	}
+
+	available.notify_one();
+
+	// An attachment that was not pooled is closed here, outside the lock.
+}
+
+void ConnectionPool::recordWait(std::chrono::steady_clock::duration wait) noexcept
+{
+	const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(wait).count();
+	const auto bucket = micros <= 0 ? 0u : static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(micros)));
+
+	++stats.waitHistogram[std::min(bucket, ConnectionPoolStats::WAIT_HISTOGRAM_BUCKETS - 1)];
+}
+
+void ConnectionPool::reaperLoop()
+{
+	std::unique_lock mutexGuard{mutex};
+
+	while (!stopping)
+	{
+		reaperWakeup.wait_for(mutexGuard, options.getReaperInterval(), [this] { return stopping; });
+
+		if (stopping)
+			break;
+
+		// Close connections idle for too long, oldest first, keeping the minimum idle ones.
+		const auto expiry = std::chrono::steady_clock::now() - options.getIdleTimeout();
+		std::vector<std::unique_ptr<Attachment>> expired;
+
+		while (idle.size() > options.getMinIdle() && idle.front().since <= expiry)
+		{
+			expired.push_back(std::move(idle.front().attachment));
+			idle.pop_front();
+		}
+
+		stats.destroyed += expired.size();
+		stats.idle = idle.size();
+
+		mutexGuard.unlock();
+		expired.clear();
+		mutexGuard.lock();
+
+		// Reopen connections to keep the minimum idle ones.
+		while (!stopping && idle.size() + opening < options.getMinIdle() &&
+			stats.leased + idle.size() + opening < options.getMaxSize())
+		{
+			++opening;
+			mutexGuard.unlock();
+
+			std::unique_ptr<Attachment> attachment;
+
+			try
+			{
+				attachment = connect();
+			}
+			catch (...)
+			{
+				// The server may be unavailable; retry on the next run.
+			}
+
+			mutexGuard.lock();
+			--opening;
+
+			if (!attachment)
+				break;
+
+			idle.push_back(IdleConnection{std::move(attachment), std::chrono::steady_clock::now()});
+			++stats.created;
+			stats.idle = idle.size();
+			available.notify_one();
+		}
+	}
+}
@@ -0,0 +1,435 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_CONNECTION_POOL_H
+#define FBCPP_CONNECTION_POOL_H
+
+#include "fb-cpp_api.h"
+#include "Attachment.h"
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <cstddef>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Client;
+	class ConnectionPool;
+
+	///
+	/// Represents options used when creating a ConnectionPool object.
+	///
+	class ConnectionPoolOptions final
+	{
+	public:
+		///
+		/// Returns the options used to attach each pooled connection.
+		///
+		const AttachmentOptions& getAttachmentOptions() const
+		{
+			return attachmentOptions;
+		}
+
+		///
+		/// Sets the options used to attach each pooled connection.
+		///
+		ConnectionPoolOptions& setAttachmentOptions(const AttachmentOptions& value)
+		{
+			attachmentOptions = value;
+			return *this;
+		}
+
+		///
+		/// Returns the minimum number of idle connections kept by the background reaper.
+		///
+		std::size_t getMinIdle() const
+		{
+			return minIdle;
+		}
+
+		///
+		/// Sets the minimum number of idle connections kept by the background reaper.
+		///
+		ConnectionPoolOptions& setMinIdle(std::size_t value)
+		{
+			minIdle = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of idle connections; connections returned beyond it are closed.
+		///
+		std::size_t getMaxIdle() const
+		{
+			return maxIdle;
+		}
+
+		///
+		/// Sets the maximum number of idle connections; connections returned beyond it are closed.
+		///
+		ConnectionPoolOptions& setMaxIdle(std::size_t value)
+		{
+			maxIdle = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of connections, idle and leased, opened by the pool.
+		///
+		std::size_t getMaxSize() const
+		{
+			return maxSize;
+		}
+
+		///
+		/// Sets the maximum number of connections, idle and leased, opened by the pool.
+		///
+		ConnectionPoolOptions& setMaxSize(std::size_t value)
+		{
+			maxSize = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of connections opened when the pool is created.
+		///
+		std::size_t getWarmup() const
+		{
+			return warmup;
+		}
+
+		///
+		/// Sets the number of connections opened when the pool is created.
+		///
+		ConnectionPoolOptions& setWarmup(std::size_t value)
+		{
+			warmup = value;
+			return *this;
+		}
+
+		///
+		/// Returns how long acquire() waits for a connection by default.
+		///
+		std::chrono::milliseconds getAcquireTimeout() const
+		{
+			return acquireTimeout;
+		}
+
+		///
+		/// Sets how long acquire() waits for a connection by default.
+		///
+		ConnectionPoolOptions& setAcquireTimeout(std::chrono::milliseconds value)
+		{
+			acquireTimeout = value;
+			return *this;
+		}
+
+		///
+		/// Returns how long a connection may stay idle before the reaper closes it.
+		///
+		std::chrono::milliseconds getIdleTimeout() const
+		{
+			return idleTimeout;
+		}
+
+		///
+		/// Sets how long a connection may stay idle before the reaper closes it.
+		///
+		ConnectionPoolOptions& setIdleTimeout(std::chrono::milliseconds value)
+		{
+			idleTimeout = value;
+			return *this;
+		}
+
+		///
+		/// Returns the interval between two runs of the background reaper.
+		///
+		std::chrono::milliseconds getReaperInterval() const
+		{
+			return reaperInterval;
+		}
+
+		///
+		/// Sets the interval between two runs of the background reaper.
+		///
+		ConnectionPoolOptions& setReaperInterval(std::chrono::milliseconds value)
+		{
+			reaperInterval = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether idle connections are pinged before being leased.
+		///
+		bool getValidateOnAcquire() const
+		{
+			return validateOnAcquire;
+		}
+
+		///
+		/// Sets whether idle connections are pinged before being leased.
+		///
+		ConnectionPoolOptions& setValidateOnAcquire(bool value)
+		{
+			validateOnAcquire = value;
+			return *this;
+		}
+
+	private:
+		AttachmentOptions attachmentOptions;
+		std::size_t minIdle = 0;
+		std::size_t maxIdle = 8;
+		std::size_t maxSize = 16;
+		std::size_t warmup = 0;
+		std::chrono::milliseconds acquireTimeout{30000};
+		std::chrono::milliseconds idleTimeout{300000};
+		std::chrono::milliseconds reaperInterval{30000};
+		bool validateOnAcquire = true;
+	};
+
+	///
+	/// Counters reported by a ConnectionPool.
+	///
+	struct ConnectionPoolStats final
+	{
+		///
+		/// Number of buckets of the acquire wait-time histogram.
+		///
+		static constexpr std::size_t WAIT_HISTOGRAM_BUCKETS = 32;
+
+		///
+		/// Number of connections opened.
+		///
+		std::uint64_t created = 0;
+
+		///
+		/// Number of connections closed.
+		///
+		std::uint64_t destroyed = 0;
+
+		///
+		/// Number of successful acquisitions.
+		///
+		std::uint64_t acquired = 0;
+
+		///
+		/// Number of acquisitions that timed out.
+		///
+		std::uint64_t timeouts = 0;
+
+		///
+		/// Number of idle connections discarded because they failed the ping on acquisition.
+		///
+		std::uint64_t validationFailures = 0;
+
+		///
+		/// Number of idle connections.
+		///
+		std::size_t idle = 0;
+
+		///
+		/// Number of leased connections.
+		///
+		std::size_t leased = 0;
+
+		///
+		/// Acquire wait times: bucket 0 counts waits under 1 microsecond, bucket `i` counts waits in
+		/// `[2^(i-1), 2^i)` microseconds, and the last bucket also counts all longer waits.
+		///
+		std::array<std::uint64_t, WAIT_HISTOGRAM_BUCKETS> waitHistogram{};
+	};
+
+	///
+	/// Exclusive use of a pooled Attachment; returns it to the pool when destroyed.
+	///
+	class FBCPP_API AttachmentLease final
+	{
+		friend class ConnectionPool;
+
+	public:
+		///
+		/// Transfers the lease; the moved-from lease becomes empty.
+		///
+		AttachmentLease(AttachmentLease&& o) noexcept
+			: pool{o.pool},
+			  attachment{std::move(o.attachment)},
+			  broken{o.broken}
+		{
+			o.pool = nullptr;
+		}
+
+		AttachmentLease& operator=(AttachmentLease&&) = delete;
+		AttachmentLease(const AttachmentLease&) = delete;
+		AttachmentLease& operator=(const AttachmentLease&) = delete;
+
+		///
+		/// Returns the attachment to the pool, or closes it if it was invalidated.
+		///
+		~AttachmentLease() noexcept;
+
+	public:
+		///
+		/// Returns the leased attachment.
+		///
+		Attachment& get() noexcept
+		{
+			return *attachment;
+		}
+
+		///
+		/// Returns the leased attachment.
+		///
+		Attachment& operator*() noexcept
+		{
+			return *attachment;
+		}
+
+		///
+		/// Accesses members of the leased attachment.
+		///
+		Attachment* operator->() noexcept
+		{
+			return attachment.get();
+		}
+
+		///
+		/// Marks the attachment as unusable so it is closed instead of returned to the pool.
+		///
+		void invalidate() noexcept
+		{
+			broken = true;
+		}
+
+	private:
+		explicit AttachmentLease(ConnectionPool* pool, std::unique_ptr<Attachment> attachment) noexcept
+			: pool{pool},
+			  attachment{std::move(attachment)}
+		{
+		}
+
+	private:
+		ConnectionPool* pool;
+		std::unique_ptr<Attachment> attachment;
+		bool broken = false;
+	};
+
+	///
+	/// Thread-safe pool of Attachment objects connected to the same database.
+	///
+	/// Connections are leased with acquire() and returned when the AttachmentLease is destroyed. Idle
+	/// connections are reused most recently returned first, validated with Attachment::ping() before being
+	/// leased, and closed by a background reaper thread after being idle for too long. The reaper also
+	/// reopens connections to keep the configured minimum of idle ones.
+	///
+	/// All leases must be destroyed before the pool.
+	///
+	class FBCPP_API ConnectionPool final
+	{
+		friend class AttachmentLease;
+
+	public:
+		///
+		/// Creates the pool, opening the warmup connections and starting the reaper thread.
+		/// `client` is used to attach to `uri`, which must remain valid while the pool exists.
+		///
+		explicit ConnectionPool(Client& client, const std::string& uri, const ConnectionPoolOptions& options = {});
+
+		ConnectionPool(const ConnectionPool&) = delete;
+		ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+		///
+		/// Stops the reaper thread and closes the idle connections.
+		///
+		~ConnectionPool() noexcept;
+
+	public:
+		///
+		/// Leases a connection, waiting up to the configured acquire timeout.
+		/// Throws FbCppException when the timeout expires.
+		///
+		AttachmentLease acquire()
+		{
+			return acquire(options.getAcquireTimeout());
+		}
+
+		///
+		/// Leases a connection, waiting up to `timeout`.
+		/// Throws FbCppException when the timeout expires.
+		///
+		AttachmentLease acquire(std::chrono::milliseconds timeout);
+
+		///
+		/// Returns a snapshot of the pool counters.
+		///
+		ConnectionPoolStats getStats() const;
+
+		///
+		/// Returns the options the pool was created with.
+		///
+		const ConnectionPoolOptions& getOptions() const noexcept
+		{
+			return options;
+		}
+
+	private:
+		struct IdleConnection final
+		{
+			std::unique_ptr<Attachment> attachment;
+			std::chrono::steady_clock::time_point since;
+		};
+
+		std::unique_ptr<Attachment> connect();
+		void release(std::unique_ptr<Attachment> attachment, bool broken) noexcept;
+		void recordWait(std::chrono::steady_clock::duration wait) noexcept;
+		void reaperLoop();
+
+	private:
+		Client& client;
+		const std::string uri;
+		const ConnectionPoolOptions options;
+		const CompiledAttachmentOptions attachmentOptions;
+		mutable std::mutex mutex;
+		std::condition_variable available;
+		std::condition_variable reaperWakeup;
+		std::deque<IdleConnection> idle;  // Most recently returned last.
+		std::size_t opening = 0;
+		bool stopping = false;
+		ConnectionPoolStats stats;
+		std::thread reaper;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_CONNECTION_POOL_H
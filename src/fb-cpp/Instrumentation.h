@@ -0,0 +1,292 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_INSTRUMENTATION_H
+#define FBCPP_INSTRUMENTATION_H
+
+#include "fb-cpp_api.h"
+#include "config.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Statement operation reported to Instrumentation::onStatement().
+	///
+	enum class StatementOperation
+	{
+		///
+		/// Statement preparation, done by the Statement constructor.
+		///
+		PREPARE,
+
+		///
+		/// Statement::execute(), including the fetch of the first row of a cursor.
+		///
+		EXECUTE,
+
+		///
+		/// One of the Statement fetch methods, including Statement::fetchBlock().
+		///
+		FETCH,
+
+		///
+		/// Statement::executeBatch().
+		///
+		EXECUTE_BATCH,
+	};
+
+	///
+	/// Transaction operation reported to Instrumentation::onTransaction().
+	///
+	enum class TransactionOperation
+	{
+		START,
+		PREPARE,
+		COMMIT,
+		COMMIT_RETAINING,
+		ROLLBACK,
+		ROLLBACK_RETAINING,
+	};
+
+	///
+	/// Direction of the blob data reported to Instrumentation::onBlob().
+	///
+	enum class BlobTransfer
+	{
+		READ,
+		WRITE,
+	};
+
+	///
+	/// @brief Receives timing and volume of the calls made to the server.
+	///
+	/// An instance is installed with Client::setInstrumentation() or Attachment::setInstrumentation().
+	/// Statement, Transaction and Blob objects take it from their Attachment when they are created.
+	/// Without an instance, each instrumented call costs a single predictable branch; building with
+	/// FB_CPP_USE_INSTRUMENTATION=0 removes the calls altogether.
+	///
+	/// Callbacks are made from the thread doing the call, so an instance shared by several attachments
+	/// must be thread-safe. Callbacks must not throw. Failed calls are not reported.
+	/// The instance must outlive the objects using it.
+	///
+	class FBCPP_API Instrumentation
+	{
+	public:
+		virtual ~Instrumentation() = default;
+
+	public:
+		///
+		/// @brief Called after a statement operation.
+		/// @param rows Number of rows fetched or, for EXECUTE_BATCH, rows executed.
+		/// @param messageBytes Number of message bytes sent to or received from the server.
+		///
+		virtual void onStatement(StatementOperation operation, std::chrono::nanoseconds elapsed, std::uint64_t rows,
+			std::uint64_t messageBytes)
+		{
+		}
+
+		///
+		/// Called after a transaction operation.
+		///
+		virtual void onTransaction(TransactionOperation operation, std::chrono::nanoseconds elapsed)
+		{
+		}
+
+		///
+		/// Called after a blob segment is read or written.
+		///
+		virtual void onBlob(BlobTransfer transfer, std::uint64_t bytes)
+		{
+		}
+	};
+
+	///
+	/// @brief Instrumentation that accumulates totals in lock-free counters.
+	///
+	/// It may be shared by any number of attachments and read while they are in use.
+	///
+	class FBCPP_API InstrumentationCounters final : public Instrumentation
+	{
+	public:
+		///
+		/// Snapshot of the counters of one statement operation.
+		///
+		struct Totals final
+		{
+			std::uint64_t calls = 0;
+			std::uint64_t nanoseconds = 0;
+			std::uint64_t rows = 0;
+			std::uint64_t messageBytes = 0;
+		};
+
+	public:
+		void onStatement(StatementOperation operation, std::chrono::nanoseconds elapsed, std::uint64_t rows,
+			std::uint64_t messageBytes) override
+		{
+			auto& counters = statementCounters[static_cast<unsigned>(operation)];
+			counters.calls.fetch_add(1, std::memory_order_relaxed);
+			counters.nanoseconds.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+			counters.rows.fetch_add(rows, std::memory_order_relaxed);
+			counters.messageBytes.fetch_add(messageBytes, std::memory_order_relaxed);
+		}
+
+		void onTransaction(TransactionOperation operation, std::chrono::nanoseconds elapsed) override
+		{
+			auto& counters = transactionCounters[static_cast<unsigned>(operation)];
+			counters.calls.fetch_add(1, std::memory_order_relaxed);
+			counters.nanoseconds.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+		}
+
+		void onBlob(BlobTransfer transfer, std::uint64_t bytes) override
+		{
+			blobBytes[static_cast<unsigned>(transfer)].fetch_add(bytes, std::memory_order_relaxed);
+		}
+
+	public:
+		///
+		/// Returns the totals of a statement operation.
+		///
+		Totals getStatementTotals(StatementOperation operation) const noexcept
+		{
+			const auto& counters = statementCounters[static_cast<unsigned>(operation)];
+
+			return Totals{
+				.calls = counters.calls.load(std::memory_order_relaxed),
+				.nanoseconds = counters.nanoseconds.load(std::memory_order_relaxed),
+				.rows = counters.rows.load(std::memory_order_relaxed),
+				.messageBytes = counters.messageBytes.load(std::memory_order_relaxed),
+			};
+		}
+
+		///
+		/// Returns the totals of a transaction operation; rows and messageBytes are always zero.
+		///
+		Totals getTransactionTotals(TransactionOperation operation) const noexcept
+		{
+			const auto& counters = transactionCounters[static_cast<unsigned>(operation)];
+
+			return Totals{
+				.calls = counters.calls.load(std::memory_order_relaxed),
+				.nanoseconds = counters.nanoseconds.load(std::memory_order_relaxed),
+			};
+		}
+
+		///
+		/// Returns the number of blob bytes read or written.
+		///
+		std::uint64_t getBlobBytes(BlobTransfer transfer) const noexcept
+		{
+			return blobBytes[static_cast<unsigned>(transfer)].load(std::memory_order_relaxed);
+		}
+
+	private:
+		struct Counters final
+		{
+			std::atomic<std::uint64_t> calls{0};
+			std::atomic<std::uint64_t> nanoseconds{0};
+			std::atomic<std::uint64_t> rows{0};
+			std::atomic<std::uint64_t> messageBytes{0};
+		};
+
+	private:
+		Counters statementCounters[static_cast<unsigned>(StatementOperation::EXECUTE_BATCH) + 1];
+		Counters transactionCounters[static_cast<unsigned>(TransactionOperation::ROLLBACK_RETAINING) + 1];
+		std::atomic<std::uint64_t> blobBytes[2]{};
+	};
+
+	namespace impl
+	{
+		///
+		/// Measures one instrumented call; does nothing when no Instrumentation is installed.
+		///
+		class InstrumentationTimer final
+		{
+		public:
+			explicit InstrumentationTimer(Instrumentation* instrumentation) noexcept
+#if FB_CPP_USE_INSTRUMENTATION
+				: instrumentation{instrumentation}
+			{
+				if (instrumentation) [[unlikely]]
+					startTime = std::chrono::steady_clock::now();
+			}
+#else
+			{
+			}
+#endif
+
+		public:
+			void reportStatement(StatementOperation operation, std::uint64_t rows, std::uint64_t messageBytes) noexcept
+			{
+#if FB_CPP_USE_INSTRUMENTATION
+				if (instrumentation) [[unlikely]]
+					instrumentation->onStatement(operation, getElapsed(), rows, messageBytes);
+#endif
+			}
+
+			void reportTransaction(TransactionOperation operation) noexcept
+			{
+#if FB_CPP_USE_INSTRUMENTATION
+				if (instrumentation) [[unlikely]]
+					instrumentation->onTransaction(operation, getElapsed());
+#endif
+			}
+
+#if FB_CPP_USE_INSTRUMENTATION
+		private:
+			std::chrono::nanoseconds getElapsed() const noexcept
+			{
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - startTime);
+			}
+
+		private:
+			Instrumentation* instrumentation;
+			std::chrono::steady_clock::time_point startTime;
+#endif
+		};
+
+		///
+		/// Reports blob data moved by one segment call.
+		///
+		inline void reportBlobTransfer(
+			Instrumentation* instrumentation, BlobTransfer transfer, std::uint64_t bytes) noexcept
+		{
+#if FB_CPP_USE_INSTRUMENTATION
+			if (instrumentation) [[unlikely]]
+				instrumentation->onBlob(transfer, bytes);
+#endif
+		}
+	}  // namespace impl
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_INSTRUMENTATION_H
@@ -280,6 +280,17 @@ namespace fbcpp::impl
 
 		template <IntegralNumber From>
 		std::string numberToString(const ScaledNumber<From>& from)
+		{
+			std::string result;
+			numberToString(from, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a scaled integer to `result`.
+		///
+		template <IntegralNumber From>
+		void numberToString(const ScaledNumber<From>& from, std::string& result)
 		{
 			char buffer[64];
 
@@ -299,8 +310,6 @@ namespace fbcpp::impl
 				unsignedValue /= 10;
 			} while (unsignedValue > 0);
 
-			std::string result;
-
 			if (isNegative)
 				result += '-';
 
@@ -335,47 +344,99 @@ namespace fbcpp::impl
 						result += buffer[i];
 				}
 			}
+		}
 
+		template <FloatingNumber From>
+		std::string numberToString(const From& from)
+		{
+			std::string result;
+			numberToString(from, result);
 			return result;
 		}
 
+		///
+		/// Appends the textual form of a floating point number to `result`.
+		/// Native types are formatted as std::to_string does.
+		///
 		template <FloatingNumber From>
-		std::string numberToString(const From& from)
+		void numberToString(const From& from, std::string& result)
 		{
 			if constexpr (std::is_floating_point_v<From>)
 			{
 				if (std::isnan(from))
-					return "NaN";
-				if (std::isinf(from))
-					return from > 0 ? "Infinity" : "-Infinity";
-				return std::to_string(from);
+					result += "NaN";
+				else if (std::isinf(from))
+					result += from > 0 ? "Infinity" : "-Infinity";
+				else
+				{
+					// Largest value in fixed notation: sign, max_exponent10 + 1 integer digits, point and 6 decimals.
+					constexpr auto BUFFER_SIZE = std::numeric_limits<From>::max_exponent10 + 1 + 8;
+					char buffer[BUFFER_SIZE];
+					const auto [ptr, ec] =
+						std::to_chars(buffer, buffer + sizeof(buffer), from, std::chars_format::fixed, 6);
+
+					if (ec != std::errc{})
+						throw FbCppException("Cannot convert floating point number to string");
+
+					result.append(buffer, ptr);
+				}
 			}
 			else
-				return from.str();
+				result += from.str();
 		}
 
 		std::string opaqueInt128ToString(const OpaqueInt128& opaqueInt128, int scale)
+		{
+			std::string result;
+			opaqueInt128ToString(opaqueInt128, scale, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a scaled 128-bit integer to `result`.
+		///
+		void opaqueInt128ToString(const OpaqueInt128& opaqueInt128, int scale, std::string& result)
 		{
 			const auto int128Util = client.getUtil()->getInt128(statusWrapper);
 			char buffer[fb::IInt128::STRING_SIZE + 1];
 			int128Util->toString(statusWrapper, &opaqueInt128, scale, static_cast<unsigned>(sizeof(buffer)), buffer);
-			return buffer;
+			result += buffer;
 		}
 
 		std::string opaqueDecFloat16ToString(const OpaqueDecFloat16& opaqueDecFloat16)
+		{
+			std::string result;
+			opaqueDecFloat16ToString(opaqueDecFloat16, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a 16-digit decimal float to `result`.
+		///
+		void opaqueDecFloat16ToString(const OpaqueDecFloat16& opaqueDecFloat16, std::string& result)
 		{
 			const auto decFloat16Util = client.getDecFloat16Util(statusWrapper);
 			char buffer[fb::IDecFloat16::STRING_SIZE + 1];
 			decFloat16Util->toString(statusWrapper, &opaqueDecFloat16, static_cast<unsigned>(sizeof(buffer)), buffer);
-			return buffer;
+			result += buffer;
 		}
 
 		std::string opaqueDecFloat34ToString(const OpaqueDecFloat34& opaqueDecFloat34)
+		{
+			std::string result;
+			opaqueDecFloat34ToString(opaqueDecFloat34, result);
+			return result;
+		}
+
+		///
+		/// Appends the textual form of a 34-digit decimal float to `result`.
+		///
+		void opaqueDecFloat34ToString(const OpaqueDecFloat34& opaqueDecFloat34, std::string& result)
 		{
 			const auto decFloat34Util = client.getDecFloat34Util(statusWrapper);
 			char buffer[fb::IDecFloat34::STRING_SIZE + 1];
 			decFloat34Util->toString(statusWrapper, &opaqueDecFloat34, static_cast<unsigned>(sizeof(buffer)), buffer);
-			return buffer;
+			result += buffer;
 		}
 
 #if FB_CPP_USE_BOOST_MULTIPRECISION != 0
@@ -0,0 +1,280 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ParallelQuery.h"
+#include "Exception.h"
+#include "Transaction.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+using namespace fbcpp;
+
+
+namespace
+{
+	struct Chunk final
+	{
+		std::size_t partition;
+		ColumnarResult result;
+	};
+
+	// Bounded queue between the workers and the consumer; cancelling it wakes up and stops both sides.
+	class ChunkQueue final
+	{
+	public:
+		explicit ChunkQueue(std::size_t capacity, std::size_t producers)
+			: capacity{capacity},
+			  producers{producers}
+		{
+		}
+
+	public:
+		bool push(Chunk&& chunk)
+		{
+			std::unique_lock lock{mutex};
+			notFull.wait(lock, [&] { return chunks.size() < capacity || cancelled; });
+
+			if (cancelled)
+				return false;
+
+			chunks.push_back(std::move(chunk));
+			notEmpty.notify_one();
+			return true;
+		}
+
+		std::optional<Chunk> pop()
+		{
+			std::unique_lock lock{mutex};
+			notEmpty.wait(lock, [&] { return !chunks.empty() || producers == 0 || cancelled; });
+
+			if (cancelled || chunks.empty())
+				return std::nullopt;
+
+			auto chunk = std::move(chunks.front());
+			chunks.pop_front();
+			notFull.notify_one();
+			return chunk;
+		}
+
+		void producerDone() noexcept
+		{
+			std::lock_guard mutexGuard{mutex};
+
+			if (--producers == 0)
+				notEmpty.notify_all();
+		}
+
+		void cancel(std::exception_ptr exception) noexcept
+		{
+			std::lock_guard mutexGuard{mutex};
+
+			if (!error)
+				error = std::move(exception);
+
+			cancelled = true;
+			notFull.notify_all();
+			notEmpty.notify_all();
+		}
+
+		bool isCancelled() const
+		{
+			std::lock_guard mutexGuard{mutex};
+			return cancelled;
+		}
+
+		std::exception_ptr getError() const
+		{
+			std::lock_guard mutexGuard{mutex};
+			return error;
+		}
+
+	private:
+		const std::size_t capacity;
+		std::size_t producers;
+		mutable std::mutex mutex;
+		std::condition_variable notFull;
+		std::condition_variable notEmpty;
+		std::deque<Chunk> chunks;
+		bool cancelled = false;
+		std::exception_ptr error;
+	};
+
+	struct Worker final
+	{
+		explicit Worker(AttachmentLease&& lease)
+			: lease{std::move(lease)}
+		{
+		}
+
+		AttachmentLease lease;
+		std::optional<Transaction> transaction;
+	};
+
+	void runWorker(Worker& worker, const std::string& sql, const ParallelQueryOptions& options,
+		const ParallelQuery::PartitionBinder& binder, std::atomic<std::size_t>& nextPartition,
+		std::size_t partitionCount, ChunkQueue& queue)
+	{
+		try
+		{
+			auto& transaction = worker.transaction.value();
+			Statement statement{worker.lease.get(), transaction, sql, options.getStatementOptions()};
+			bool stopped = false;
+
+			while (!stopped && !queue.isCancelled())
+			{
+				const auto partition = nextPartition.fetch_add(1);
+
+				if (partition >= partitionCount)
+					break;
+
+				binder(statement, partition);
+
+				if (!statement.execute(transaction))
+					continue;
+
+				while (true)
+				{
+					ColumnarResult chunk{statement};
+					const auto rows = chunk.drain(statement, options.getChunkRows());
+
+					if (rows != 0 && !queue.push(Chunk{partition, std::move(chunk)}))
+					{
+						stopped = true;
+						break;
+					}
+
+					if (rows < options.getChunkRows())
+						break;
+				}
+			}
+		}
+		catch (...)
+		{
+			queue.cancel(std::current_exception());
+		}
+
+		queue.producerDone();
+	}
+}  // namespace
+
+
+ParallelQuery::ParallelQuery(ConnectionPool& pool, std::string sql, const ParallelQueryOptions& options)
+	: pool{pool},
+	  sql{std::move(sql)},
+	  options{options}
+{
+	if (options.getChunkRows() == 0)
+		throw std::invalid_argument{"ParallelQuery chunk size must be greater than zero"};
+}
+
+ParallelQueryStats ParallelQuery::run(
+	std::size_t partitionCount, const PartitionBinder& binder, const Consumer& consumer)
+{
+	ParallelQueryStats stats;
+
+	if (partitionCount == 0)
+		return stats;
+
+	const auto parallelism = options.getParallelism() != 0
+		? options.getParallelism()
+		: std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+	const auto workerCount = std::min({parallelism, partitionCount, pool.getOptions().getMaxSize()});
+	const auto queueCapacity = options.getQueueCapacity() != 0 ? options.getQueueCapacity() : workerCount * 2;
+
+	// All transactions are started before any worker runs, while the first one is certainly active,
+	// so the others can share its snapshot.
+	auto transactionOptions = TransactionOptions()
+								  .setIsolationLevel(TransactionIsolationLevel::SNAPSHOT)
+								  .setAccessMode(TransactionAccessMode::READ_ONLY);
+
+	std::vector<Worker> workers;
+	workers.reserve(workerCount);
+	stats.sharedSnapshot = workerCount == 1;
+
+	for (std::size_t i = 0; i < workerCount; ++i)
+	{
+		auto& worker = workers.emplace_back(pool.acquire());
+		worker.transaction.emplace(worker.lease.get(), transactionOptions);
+
+		if (i == 0 && workerCount > 1 && options.getShareSnapshot())
+		{
+			try
+			{
+				transactionOptions.setAtSnapshotNumber(worker.transaction->getSnapshotNumber());
+				stats.sharedSnapshot = true;
+			}
+			catch (const FbCppException&)
+			{
+				// server without snapshot sharing
+			}
+		}
+	}
+
+	ChunkQueue queue{queueCapacity, workerCount};
+	std::atomic<std::size_t> nextPartition{0};
+	std::vector<std::thread> threads;
+	threads.reserve(workerCount);
+
+	try
+	{
+		for (auto& worker : workers)
+		{
+			threads.emplace_back(runWorker, std::ref(worker), std::cref(sql), std::cref(options), std::cref(binder),
+				std::ref(nextPartition), partitionCount, std::ref(queue));
+		}
+
+		while (auto chunk = queue.pop())
+		{
+			consumer(chunk->partition, chunk->result);
+			stats.rowCount += chunk->result.getRowCount();
+			++stats.chunkCount;
+		}
+	}
+	catch (...)
+	{
+		queue.cancel(std::current_exception());
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	if (const auto error = queue.getError())
+		std::rethrow_exception(error);
+
+	for (auto& worker : workers)
+		worker.transaction->commit();
+
+	stats.workerCount = workerCount;
+
+	return stats;
+}
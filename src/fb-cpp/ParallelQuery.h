@@ -0,0 +1,245 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_PARALLEL_QUERY_H
+#define FBCPP_PARALLEL_QUERY_H
+
+#include "fb-cpp_api.h"
+#include "ColumnarResult.h"
+#include "ConnectionPool.h"
+#include "Statement.h"
+#include "StructBinding.h"
+#include <functional>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// Represents options used when creating a ParallelQuery object.
+	///
+	class ParallelQueryOptions final
+	{
+	public:
+		///
+		/// Returns the maximum number of partitions run at the same time.
+		///
+		std::size_t getParallelism() const
+		{
+			return parallelism;
+		}
+
+		///
+		/// Sets the maximum number of partitions run at the same time, each on its own pooled attachment.
+		/// `0` (default) uses the number of hardware threads. It is further capped by the partition count.
+		///
+		ParallelQueryOptions& setParallelism(std::size_t value)
+		{
+			parallelism = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of rows of each chunk handed to the consumer.
+		///
+		std::size_t getChunkRows() const
+		{
+			return chunkRows;
+		}
+
+		///
+		/// Sets the maximum number of rows of each chunk handed to the consumer.
+		///
+		ParallelQueryOptions& setChunkRows(std::size_t value)
+		{
+			chunkRows = value;
+			return *this;
+		}
+
+		///
+		/// Returns the maximum number of chunks waiting for the consumer.
+		///
+		std::size_t getQueueCapacity() const
+		{
+			return queueCapacity;
+		}
+
+		///
+		/// Sets the maximum number of chunks waiting for the consumer. Workers stop fetching while the queue is
+		/// full, which bounds memory use when the consumer is slower than the server.
+		/// `0` (default) uses twice the parallelism.
+		///
+		ParallelQueryOptions& setQueueCapacity(std::size_t value)
+		{
+			queueCapacity = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether all partitions are read from the same snapshot.
+		///
+		bool getShareSnapshot() const
+		{
+			return shareSnapshot;
+		}
+
+		///
+		/// Sets whether all partitions are read from the same snapshot (default `true`).
+		/// Requires Firebird 4.0+; with older servers each partition uses its own snapshot.
+		///
+		ParallelQueryOptions& setShareSnapshot(bool value)
+		{
+			shareSnapshot = value;
+			return *this;
+		}
+
+		///
+		/// Returns the options used to prepare the statement on each attachment.
+		///
+		const StatementOptions& getStatementOptions() const
+		{
+			return statementOptions;
+		}
+
+		///
+		/// Sets the options used to prepare the statement on each attachment.
+		///
+		ParallelQueryOptions& setStatementOptions(const StatementOptions& value)
+		{
+			statementOptions = value;
+			return *this;
+		}
+
+	private:
+		std::size_t parallelism = 0;
+		std::size_t chunkRows = 8192;
+		std::size_t queueCapacity = 0;
+		bool shareSnapshot = true;
+		StatementOptions statementOptions = StatementOptions().setFetchBufferRows(512);
+	};
+
+	///
+	/// @brief Summary of a ParallelQuery::run() call.
+	///
+	struct ParallelQueryStats final
+	{
+		///
+		/// Total number of rows handed to the consumer.
+		///
+		std::uint64_t rowCount = 0;
+
+		///
+		/// Total number of chunks handed to the consumer.
+		///
+		std::uint64_t chunkCount = 0;
+
+		///
+		/// Number of attachments used.
+		///
+		std::size_t workerCount = 0;
+
+		///
+		/// Whether all partitions were read from the same snapshot.
+		///
+		bool sharedSnapshot = false;
+	};
+
+	///
+	/// @brief Runs a parameterized query once per partition, in parallel over pooled attachments.
+	///
+	/// Each worker holds one attachment from the pool, one read-only SNAPSHOT transaction and one prepared
+	/// statement, and takes partitions in order until none is left. Rows are fetched into ColumnarResult
+	/// chunks that go through a bounded queue to the consumer, which runs on the thread calling run().
+	///
+	/// With Firebird 4.0+ all worker transactions share the snapshot of the first one, so the partitions
+	/// together see one consistent state of the database, as a single query would.
+	///
+	class FBCPP_API ParallelQuery final
+	{
+	public:
+		///
+		/// Binds the parameters of a partition. Called from worker threads, possibly concurrently.
+		///
+		using PartitionBinder = std::function<void(Statement& statement, std::size_t partition)>;
+
+		///
+		/// Receives the rows of a partition, in chunks, on the thread calling run().
+		/// Chunks of different partitions are interleaved; chunks of one partition arrive in order.
+		///
+		using Consumer = std::function<void(std::size_t partition, ColumnarResult& chunk)>;
+
+	public:
+		///
+		/// @brief Creates a query over the pool.
+		/// @throws std::invalid_argument if the chunk size is zero.
+		///
+		explicit ParallelQuery(ConnectionPool& pool, std::string sql, const ParallelQueryOptions& options = {});
+
+		ParallelQuery(const ParallelQuery&) = delete;
+		ParallelQuery& operator=(const ParallelQuery&) = delete;
+
+	public:
+		///
+		/// @brief Runs the query for partitions `0` to `partitionCount - 1` and waits until all rows were consumed.
+		/// @throws The first exception raised by a worker or by the consumer; other workers are then stopped.
+		///
+		ParallelQueryStats run(std::size_t partitionCount, const PartitionBinder& binder, const Consumer& consumer);
+
+		///
+		/// @brief Runs the query once for each element of `partitions`, binding it as all input parameters,
+		/// e.g. a `std::pair` with the bounds of a key range.
+		///
+		template <typename P>
+			requires Aggregate<P> || TupleLike<P>
+		ParallelQueryStats run(const std::vector<P>& partitions, const Consumer& consumer)
+		{
+			return run(
+				partitions.size(), [&partitions](Statement& statement, std::size_t partition)
+				{ statement.set(partitions[partition]); }, consumer);
+		}
+
+		///
+		/// Returns the options.
+		///
+		const ParallelQueryOptions& getOptions() const noexcept
+		{
+			return options;
+		}
+
+	private:
+		ConnectionPool& pool;
+		const std::string sql;
+		const ParallelQueryOptions options;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_PARALLEL_QUERY_H
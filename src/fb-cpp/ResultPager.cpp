@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ResultPager.h"
+#include "Exception.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+using namespace fbcpp;
+
+
+ResultPager::ResultPager(Statement& statement, unsigned pageSize, std::size_t cachedPages)
+	: statement{statement},
+	  pageSize{pageSize},
+	  cachedPages{cachedPages}
+{
+	if (pageSize == 0)
+		throw std::invalid_argument{"ResultPager page size must be greater than zero"};
+
+	if (cachedPages == 0)
+		throw std::invalid_argument{"ResultPager must cache at least one page"};
+
+	if (statement.getCursorType() != CursorType::SCROLLABLE)
+		throw FbCppException("ResultPager requires a statement prepared with CursorType::SCROLLABLE");
+}
+
+std::span<const RowView> ResultPager::getPage(unsigned pageIndex)
+{
+	for (auto it = pages.begin(); it != pages.end(); ++it)
+	{
+		if (it->index == pageIndex)
+		{
+			pages.splice(pages.begin(), pages, it);
+			return pages.front().rows;
+		}
+	}
+
+	// Positions are passed to the server as int.
+	const auto firstPosition = std::uint64_t{pageIndex} * pageSize + 1;
+
+	if (firstPosition > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ||
+		(rowCount && firstPosition > rowCount.value()))
+	{
+		return {};
+	}
+
+	// When the cache is full, the least recently used page is evicted and its storage reused.
+	Page page;
+
+	if (pages.size() >= cachedPages)
+	{
+		page = std::move(pages.back());
+		pages.pop_back();
+	}
+
+	constexpr auto alignment = alignof(std::max_align_t);
+	const auto messageLength = statement.getOutputMessageLength();
+	const auto stride = (messageLength + alignment - 1) / alignment * alignment;
+
+	page.index = pageIndex;
+	page.rows.clear();
+	page.data.resize(stride * pageSize);
+
+	unsigned count = 0;
+	auto fetched = statement.fetchAbsolute(static_cast<unsigned>(firstPosition));
+
+	while (fetched)
+	{
+		std::memcpy(&page.data[count * stride], statement.getCurrentRow().getMessage(), messageLength);
+
+		if (++count == pageSize)
+			break;
+
+		fetched = statement.fetchNext();
+	}
+
+	if (count == 0)
+		return {};
+
+	if (count < pageSize)
+		rowCount = static_cast<unsigned>(firstPosition - 1 + count);
+
+	for (unsigned index = 0; index < count; ++index)
+		page.rows.emplace_back(&page.data[index * stride]);
+
+	// Moving the page keeps its buffer, so the views stay valid.
+	pages.push_front(std::move(page));
+
+	return pages.front().rows;
+}
+
+unsigned ResultPager::getRowCount()
+{
+	if (rowCount)
+		return rowCount.value();
+
+	if (!statement.fetchFirst())
+	{
+		rowCount = 0;
+		return 0;
+	}
+
+	// Exponential search for a position past the end, then binary search for the last row.
+	constexpr std::uint64_t maxPosition = std::numeric_limits<int>::max();
+	std::uint64_t low = 1;
+	std::uint64_t high = 2;
+
+	while (high <= maxPosition && statement.fetchAbsolute(static_cast<unsigned>(high)))
+	{
+		low = high;
+		high *= 2;
+	}
+
+	high = std::min(high, maxPosition + 1);
+
+	while (high - low > 1)
+	{
+		const auto middle = low + (high - low) / 2;
+
+		if (statement.fetchAbsolute(static_cast<unsigned>(middle)))
+			low = middle;
+		else
+			high = middle;
+	}
+
+	rowCount = static_cast<unsigned>(low);
+	return rowCount.value();
+}
+
+void ResultPager::clear() noexcept
+{
+	pages.clear();
+	rowCount.reset();
+}
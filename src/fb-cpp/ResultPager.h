@@ -0,0 +1,125 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_RESULT_PAGER_H
+#define FBCPP_RESULT_PAGER_H
+
+#include "fb-cpp_api.h"
+#include "Statement.h"
+#include <list>
+#include <optional>
+#include <span>
+#include <vector>
+#include <cstddef>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	///
+	/// @brief Serves fixed-size pages of an open scrollable cursor, keeping recently used pages in memory.
+	///
+	/// Intended for grids that page back and forth over a large result: each page is read with one
+	/// Statement::fetchAbsolute() followed by fetchNext() calls, instead of re-executing the query with OFFSET.
+	/// The statement must be prepared with CursorType::SCROLLABLE and already executed. Reading a page moves
+	/// the cursor, so the statement must not be used for fetching while the pager is in use.
+	///
+	/// Row values are read by passing a row to Statement::setCurrentRow() and using the statement getters.
+	///
+	class FBCPP_API ResultPager final
+	{
+	public:
+		///
+		/// Default number of pages kept in memory.
+		///
+		static constexpr std::size_t DEFAULT_CACHED_PAGES = 8;
+
+	public:
+		///
+		/// @brief Creates a pager over the open cursor of `statement`.
+		/// @throws std::invalid_argument if pageSize or cachedPages is zero.
+		/// @throws FbCppException if the statement was not prepared with a scrollable cursor.
+		///
+		explicit ResultPager(Statement& statement, unsigned pageSize, std::size_t cachedPages = DEFAULT_CACHED_PAGES);
+
+		ResultPager(const ResultPager&) = delete;
+		ResultPager& operator=(const ResultPager&) = delete;
+
+	public:
+		///
+		/// @brief Returns the rows of the zero-based page `pageIndex`; empty past the end of the result.
+		///
+		/// The views stay valid until the next call to getPage() or clear().
+		///
+		std::span<const RowView> getPage(unsigned pageIndex);
+
+		///
+		/// @brief Returns the number of rows of the result, found with a logarithmic number of positioned fetches
+		/// the first time and cached afterwards.
+		///
+		unsigned getRowCount();
+
+		///
+		/// @brief Returns the number of pages of the result.
+		///
+		unsigned getPageCount()
+		{
+			return (getRowCount() + pageSize - 1) / pageSize;
+		}
+
+		///
+		/// @brief Returns the page size.
+		///
+		unsigned getPageSize() const noexcept
+		{
+			return pageSize;
+		}
+
+		///
+		/// @brief Drops the cached pages and row count, e.g. after the statement was executed again.
+		///
+		void clear() noexcept;
+
+	private:
+		struct Page final
+		{
+			unsigned index;
+			std::vector<std::byte> data;
+			std::vector<RowView> rows;
+		};
+
+	private:
+		Statement& statement;
+		const unsigned pageSize;
+		const std::size_t cachedPages;
+		std::list<Page> pages;  // Most recently used first.
+		std::optional<unsigned> rowCount;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_RESULT_PAGER_H
@@ -0,0 +1,400 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ROW_BINDER_H
+#define FBCPP_ROW_BINDER_H
+
+#include "Statement.h"
+#include "CalendarConverter.h"
+#include "Descriptor.h"
+#include "Exception.h"
+#include "StructBinding.h"
+#include "types.h"
+#include <cstring>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	namespace impl
+	{
+		template <typename T, std::size_t I, bool = Aggregate<T>>
+		struct RowFieldType
+		{
+			using Type = reflection::FieldType<T, I>;
+		};
+
+		template <typename T, std::size_t I>
+		struct RowFieldType<T, I, false>
+		{
+			using Type = std::remove_cvref_t<std::tuple_element_t<I, T>>;
+		};
+
+		template <typename F>
+		struct RowValueType
+		{
+			using Type = F;
+		};
+
+		template <typename F>
+		struct RowValueType<std::optional<F>>
+		{
+			using Type = F;
+		};
+	}  // namespace impl
+
+	///
+	/// @brief Maps rows of a Statement into an aggregate or tuple-like type through a plan built once.
+	///
+	/// The constructor checks the field count against the output descriptors and resolves each field to
+	/// its message offsets plus a conversion function chosen for the field type and column type. Reading
+	/// a row then runs one null check and one direct conversion per field, with no descriptor lookup or
+	/// type switch.
+	///
+	/// Exact and lossless pairs are converted directly: BOOLEAN to bool; unscaled integers to wider or
+	/// equal integer types; FLOAT and DOUBLE to float/double; STRING to std::string; DATE, TIME and
+	/// TIMESTAMP to their fb-cpp types; BLOB to BlobId. Any other pair, and variant fields, use the
+	/// Statement accessors, so conversions and errors are the same as with Statement::get<T>().
+	///
+	/// The binder reads the current row of the statement, including rows selected with
+	/// Statement::setCurrentRow(). It must not outlive the statement.
+	///
+	template <typename T>
+		requires Aggregate<T> || TupleLike<T>
+	class RowBinder final
+	{
+	private:
+		template <std::size_t I>
+		using FieldType = typename impl::RowFieldType<T, I>::Type;
+
+		template <typename F>
+		using ValueType = typename impl::RowValueType<F>::Type;
+
+		template <typename V>
+		using Reader = void (*)(Statement& statement, const std::byte* data, unsigned index, V& value);
+
+		template <typename V>
+		struct Column final
+		{
+			unsigned index;
+			unsigned offset;
+			unsigned nullOffset;
+			Reader<V> reader;
+		};
+
+		static constexpr std::size_t FIELD_COUNT = [] {
+			if constexpr (Aggregate<T>)
+				return impl::reflection::fieldCountV<T>;
+			else
+				return std::tuple_size_v<T>;
+		}();
+
+		template <typename Seq>
+		struct PlanImpl;
+
+		template <std::size_t... Is>
+		struct PlanImpl<std::index_sequence<Is...>>
+		{
+			using Type = std::tuple<Column<ValueType<FieldType<Is>>>...>;
+		};
+
+		using Plan = typename PlanImpl<std::make_index_sequence<FIELD_COUNT>>::Type;
+
+	public:
+		///
+		/// @brief Builds the row plan for the output columns of `statement`.
+		/// @throws FbCppException if the field count does not match the output column count.
+		///
+		explicit RowBinder(Statement& statement)
+			: statement{statement},
+			  plan{makePlan(statement.getOutputDescriptors(), std::make_index_sequence<FIELD_COUNT>{})}
+		{
+		}
+
+		RowBinder(const RowBinder&) = delete;
+		RowBinder& operator=(const RowBinder&) = delete;
+
+	public:
+		///
+		/// @brief Returns the current row as a new `T`.
+		/// @throws FbCppException if a NULL value is encountered for a non-optional field.
+		///
+		T get()
+		{
+			return get(std::make_index_sequence<FIELD_COUNT>{});
+		}
+
+		///
+		/// @brief Reads the current row into an existing `T`, reusing storage such as string capacity.
+		/// @throws FbCppException if a NULL value is encountered for a non-optional field.
+		///
+		void read(T& value)
+		{
+			read(value, std::make_index_sequence<FIELD_COUNT>{});
+		}
+
+	private:
+		template <std::size_t... Is>
+		static Plan makePlan(const std::vector<Descriptor>& descriptors, std::index_sequence<Is...>)
+		{
+			if (FIELD_COUNT != descriptors.size())
+			{
+				throw FbCppException("Row field count (" + std::to_string(FIELD_COUNT) +
+					") does not match output column count (" + std::to_string(descriptors.size()) + ")");
+			}
+
+			return Plan{makeColumn<ValueType<FieldType<Is>>>(descriptors[Is], static_cast<unsigned>(Is))...};
+		}
+
+		template <typename V>
+		static Column<V> makeColumn(const Descriptor& descriptor, unsigned index)
+		{
+			return Column<V>{index, descriptor.offset, descriptor.nullOffset, selectReader<V>(descriptor)};
+		}
+
+		template <typename V>
+		static Reader<V> selectReader(const Descriptor& descriptor)
+		{
+			using enum DescriptorAdjustedType;
+
+			[[maybe_unused]] const auto type = descriptor.adjustedType;
+			[[maybe_unused]] const bool unscaled = descriptor.scale == 0;
+
+			if constexpr (impl::reflection::isVariantV<V>)
+				return &readVariant<V>;
+			else if constexpr (std::is_same_v<V, bool>)
+			{
+				if (type == BOOLEAN)
+					return &readBoolean;
+			}
+			else if constexpr (std::is_same_v<V, std::int16_t>)
+			{
+				if (type == INT16 && unscaled)
+					return &readCopy<V, std::int16_t>;
+			}
+			else if constexpr (std::is_same_v<V, std::int32_t>)
+			{
+				if (type == INT16 && unscaled)
+					return &readCopy<V, std::int16_t>;
+				if (type == INT32 && unscaled)
+					return &readCopy<V, std::int32_t>;
+			}
+			else if constexpr (std::is_same_v<V, std::int64_t>)
+			{
+				if (type == INT16 && unscaled)
+					return &readCopy<V, std::int16_t>;
+				if (type == INT32 && unscaled)
+					return &readCopy<V, std::int32_t>;
+				if (type == INT64 && unscaled)
+					return &readCopy<V, std::int64_t>;
+			}
+			else if constexpr (std::is_same_v<V, float>)
+			{
+				if (type == FLOAT)
+					return &readCopy<V, float>;
+			}
+			else if constexpr (std::is_same_v<V, double>)
+			{
+				if (type == FLOAT)
+					return &readCopy<V, float>;
+				if (type == DOUBLE)
+					return &readCopy<V, double>;
+			}
+			else if constexpr (std::is_same_v<V, std::string>)
+			{
+				if (type == STRING)
+					return &readString;
+			}
+			else if constexpr (std::is_same_v<V, Date>)
+			{
+				if (type == DATE)
+					return &readDate;
+			}
+			else if constexpr (std::is_same_v<V, Time>)
+			{
+				if (type == TIME)
+					return &readTime;
+			}
+			else if constexpr (std::is_same_v<V, Timestamp>)
+			{
+				if (type == TIMESTAMP)
+					return &readTimestamp;
+			}
+			else if constexpr (std::is_same_v<V, BlobId>)
+			{
+				if (type == BLOB)
+					return &readBlobId;
+			}
+
+			if constexpr (!impl::reflection::isVariantV<V>)
+				return &readConverted<V>;
+		}
+
+		template <std::size_t... Is>
+		T get(std::index_sequence<Is...>)
+		{
+			const auto message = statement.getCurrentRow().getMessage();
+			return T{readField<FieldType<Is>>(message, std::get<Is>(plan))...};
+		}
+
+		template <std::size_t... Is>
+		void read(T& value, std::index_sequence<Is...>)
+		{
+			const auto message = statement.getCurrentRow().getMessage();
+
+			if constexpr (Aggregate<T>)
+			{
+				auto fields = impl::reflection::toTupleRef(value);
+				(readField(message, std::get<Is>(plan), std::get<Is>(fields)), ...);
+			}
+			else
+				(readField(message, std::get<Is>(plan), std::get<Is>(value)), ...);
+		}
+
+		template <typename F>
+		F readField(const std::byte* message, const Column<ValueType<F>>& column)
+		{
+			F value{};
+			readField(message, column, value);
+			return value;
+		}
+
+		template <typename F>
+		void readField(const std::byte* message, const Column<ValueType<F>>& column, F& value)
+		{
+			if constexpr (impl::reflection::isVariantV<F>)
+				column.reader(statement, message + column.offset, column.index, value);
+			else
+			{
+				const bool isNull =
+					*reinterpret_cast<const std::int16_t*>(&message[column.nullOffset]) != FB_FALSE;
+
+				if constexpr (impl::reflection::isOptionalV<F>)
+				{
+					if (isNull)
+						value.reset();
+					else
+					{
+						if (!value.has_value())
+							value.emplace();
+
+						column.reader(statement, message + column.offset, column.index, *value);
+					}
+				}
+				else
+				{
+					if (isNull)
+					{
+						throw FbCppException(
+							"Null value encountered for non-optional field at index " + std::to_string(column.index));
+					}
+
+					column.reader(statement, message + column.offset, column.index, value);
+				}
+			}
+		}
+
+		template <typename V, typename Source>
+		static void readCopy(Statement&, const std::byte* data, unsigned, V& value)
+		{
+			Source source;
+			std::memcpy(&source, data, sizeof(source));
+			value = static_cast<V>(source);
+		}
+
+		static void readBoolean(Statement&, const std::byte* data, unsigned, bool& value)
+		{
+			value = *data != std::byte{0};
+		}
+
+		static void readString(Statement&, const std::byte* data, unsigned, std::string& value)
+		{
+			std::uint16_t length;
+			std::memcpy(&length, data, sizeof(length));
+			value.assign(reinterpret_cast<const char*>(data + sizeof(length)), length);
+		}
+
+		static void readDate(Statement&, const std::byte* data, unsigned, Date& value)
+		{
+			ISC_DATE date;
+			std::memcpy(&date, data, sizeof(date));
+			value = impl::CalendarConverter::decodeDate(date);
+		}
+
+		static void readTime(Statement&, const std::byte* data, unsigned, Time& value)
+		{
+			ISC_TIME time;
+			std::memcpy(&time, data, sizeof(time));
+			value = impl::CalendarConverter::decodeTime(time);
+		}
+
+		static void readTimestamp(Statement& statement, const std::byte* data, unsigned index, Timestamp& value)
+		{
+			ISC_TIMESTAMP timestamp;
+			std::memcpy(&timestamp, data, sizeof(timestamp));
+
+			const auto date = impl::CalendarConverter::decodeDate(timestamp.timestamp_date);
+
+			// Let the statement raise its usual error.
+			if (!date.ok()) [[unlikely]]
+				return readConverted(statement, data, index, value);
+
+			value = Timestamp{date, impl::CalendarConverter::decodeTime(timestamp.timestamp_time)};
+		}
+
+		static void readBlobId(Statement&, const std::byte* data, unsigned, BlobId& value)
+		{
+			std::memcpy(&value.id, data, sizeof(value.id));
+		}
+
+		template <typename V>
+		static void readConverted(Statement& statement, const std::byte*, unsigned index, V& value)
+		{
+			value = std::move(statement.get<std::optional<V>>(index).value());
+		}
+
+		template <typename V>
+		static void readVariant(Statement& statement, const std::byte*, unsigned index, V& value)
+		{
+			value = statement.get<V>(index);
+		}
+
+	private:
+		Statement& statement;
+		Plan plan;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ROW_BINDER_H
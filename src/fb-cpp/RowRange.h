@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_ROW_RANGE_H
+#define FBCPP_ROW_RANGE_H
+
+#include "Statement.h"
+#include "RowBinder.h"
+#include "Exception.h"
+#include "StructBinding.h"
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <cstddef>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Transaction;
+
+	///
+	/// @brief Input range over the rows of an executed Statement, returned by Statement::rows().
+	///
+	/// Rows are read with a RowBinder into one `T` owned by the range. Dereferencing an iterator gives that
+	/// object, which is overwritten when the iterator is incremented; its content may be moved out. Reading a
+	/// row does no heap allocation beyond what `T` itself needs.
+	///
+	/// The range can be iterated only once and must not outlive the statement or the transaction.
+	///
+	template <typename T>
+	class RowRange final
+	{
+	private:
+		using Storage = std::conditional_t<Aggregate<T> || TupleLike<T>, T, std::tuple<T>>;
+
+	public:
+		///
+		/// @brief Iterator over the rows of a RowRange.
+		///
+		class Iterator final
+		{
+		public:
+			using iterator_concept = std::input_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+
+		public:
+			Iterator() = default;
+
+		private:
+			explicit Iterator(RowRange* range) noexcept
+				: range{range}
+			{
+			}
+
+		public:
+			T& operator*() const noexcept
+			{
+				return range->getValue();
+			}
+
+			T* operator->() const noexcept
+			{
+				return &range->getValue();
+			}
+
+			Iterator& operator++()
+			{
+				range->advance();
+				return *this;
+			}
+
+			void operator++(int)
+			{
+				++*this;
+			}
+
+			friend bool operator==(const Iterator& iterator, std::default_sentinel_t) noexcept
+			{
+				return iterator.isEnd();
+			}
+
+		private:
+			bool isEnd() const noexcept
+			{
+				return !range || range->finished;
+			}
+
+		private:
+			RowRange* range = nullptr;
+
+			friend class RowRange;
+		};
+
+	public:
+		///
+		/// @brief Creates a range over the rows of `statement`, validating `T` against its output columns.
+		/// The statement is executed by begin().
+		///
+		explicit RowRange(Statement& statement, Transaction& transaction)
+			: statement{statement},
+			  transaction{transaction},
+			  binder{statement}
+		{
+		}
+
+		RowRange(const RowRange&) = delete;
+		RowRange& operator=(const RowRange&) = delete;
+
+	public:
+		///
+		/// @brief Executes the statement and returns an iterator to its first row.
+		/// @throws FbCppException if called more than once.
+		///
+		Iterator begin()
+		{
+			if (started)
+				throw FbCppException("RowRange can only be iterated once");
+
+			started = true;
+
+			if (!statement.execute(transaction))
+				finished = true;
+			else if (!statement.getResultSetHandle())
+			{
+				// Singleton result, e.g. EXECUTE PROCEDURE or RETURNING, already in the output message.
+				singleton = true;
+				binder.read(storage);
+			}
+			else
+				fetchBlock();
+
+			return Iterator{this};
+		}
+
+		std::default_sentinel_t end() const noexcept
+		{
+			return std::default_sentinel;
+		}
+
+	private:
+		T& getValue() noexcept
+		{
+			if constexpr (std::is_same_v<Storage, T>)
+				return storage;
+			else
+				return std::get<0>(storage);
+		}
+
+		void advance()
+		{
+			if (singleton)
+				finished = true;
+			else if (++position < block.size())
+			{
+				statement.setCurrentRow(block[position]);
+				binder.read(storage);
+			}
+			else
+				fetchBlock();
+		}
+
+		void fetchBlock()
+		{
+			block = statement.fetchBlock();
+			position = 0;
+
+			if (block.empty())
+				finished = true;
+			else
+				binder.read(storage);
+		}
+
+	private:
+		Statement& statement;
+		Transaction& transaction;
+		RowBinder<Storage> binder;
+		Storage storage{};
+		std::span<const RowView> block;
+		std::size_t position = 0;
+		bool started = false;
+		bool singleton = false;
+		bool finished = false;
+	};
+
+	template <typename T>
+	RowRange<T> Statement::rows(Transaction& transaction)
+	{
+		return RowRange<T>{*this, transaction};
+	}
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_ROW_RANGE_H
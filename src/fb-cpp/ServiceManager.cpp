@@ -0,0 +1,410 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "ServiceManager.h"
+#include "Client.h"
+#include "Exception.h"
+#include "firebird/impl/inf_pub.h"
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using namespace fbcpp;
+using namespace fbcpp::impl;
+
+
+// The length of each query response item is 16 bits wide.
+static constexpr std::size_t QUERY_BUFFER_SIZE = 65535;
+
+
+static FbUniquePtr<fb::IXpbBuilder> newStartBuilder(Client& client, StatusWrapper& statusWrapper, std::uint8_t action)
+{
+	auto builder = fbUnique(client.getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::SPB_START, nullptr, 0));
+	builder->insertTag(&statusWrapper, action);
+	return builder;
+}
+
+
+ServiceManager::ServiceManager(Client& client, const ServiceManagerOptions& options)
+	: client{client},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()}
+{
+	auto spbBuilder =
+		fbUnique(client.getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::SPB_ATTACH, nullptr, 0));
+
+	if (const auto userName = options.getUserName())
+		spbBuilder->insertString(&statusWrapper, isc_spb_user_name, userName->c_str());
+
+	if (const auto password = options.getPassword())
+		spbBuilder->insertString(&statusWrapper, isc_spb_password, password->c_str());
+
+	if (const auto role = options.getRole())
+		spbBuilder->insertString(&statusWrapper, isc_spb_sql_role_name, role->c_str());
+
+	const auto& server = options.getServer();
+	const auto serviceName = server && !server->empty() ? *server + ":service_mgr" : std::string{"service_mgr"};
+
+	auto dispatcher = fbRef(client.getMaster()->getDispatcher());
+	handle.reset(dispatcher->attachServiceManager(&statusWrapper, serviceName.c_str(),
+		spbBuilder->getBufferLength(&statusWrapper), spbBuilder->getBuffer(&statusWrapper)));
+}
+
+void ServiceManager::disconnect()
+{
+	assert(isValid());
+
+	handle->detach(&statusWrapper);
+	handle.reset();
+}
+
+void ServiceManager::backup(const BackupOptions& options, const OutputCallback& output)
+{
+	assert(isValid());
+
+	auto builder = buildBackup(options, options.getBackupFile());
+
+	if (options.getVerbose())
+		builder->insertTag(&statusWrapper, isc_spb_verbose);
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+	readOutput(output);
+}
+
+void ServiceManager::restore(const RestoreOptions& options, const OutputCallback& output)
+{
+	assert(isValid());
+
+	auto builder = buildRestore(options, options.getBackupFile());
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+	readOutput(output);
+}
+
+ServiceTransferStatistics ServiceManager::backupTo(const BackupOptions& options, const BackupSink& sink)
+{
+	assert(isValid());
+
+	if (!sink)
+		throw std::invalid_argument{"ServiceManager::backupTo sink must not be empty"};
+
+	const auto startTime = std::chrono::steady_clock::now();
+	ServiceTransferStatistics statistics;
+
+	// With "stdout" as the backup file, the service output is the backup itself.
+	auto builder = buildBackup(options, "stdout");
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+	readToEof(
+		[&](std::span<const std::uint8_t> data)
+		{
+			sink(std::as_bytes(data));
+			statistics.bytes += data.size();
+		});
+
+	statistics.elapsed = std::chrono::steady_clock::now() - startTime;
+	return statistics;
+}
+
+ServiceTransferStatistics ServiceManager::restoreFrom(
+	const RestoreOptions& options, const BackupSource& source, const OutputCallback& output)
+{
+	assert(isValid());
+
+	if (!source)
+		throw std::invalid_argument{"ServiceManager::restoreFrom source must not be empty"};
+
+	const auto startTime = std::chrono::steady_clock::now();
+	ServiceTransferStatistics statistics;
+
+	// With "stdin" as the backup file, the service asks for data with isc_info_svc_stdin and receives it
+	// in the send items of the next query. An empty chunk marks the end of the backup.
+	auto builder = buildRestore(options, "stdin");
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+
+	const std::uint8_t items[] = {isc_info_svc_stdin, isc_info_svc_line};
+
+	if (buffer.empty())
+		buffer.resize(QUERY_BUFFER_SIZE);
+
+	if (sendBuffer.empty())
+		sendBuffer.resize(QUERY_BUFFER_SIZE);
+
+	std::uint64_t requested = 0;
+	bool sourceEnded = false;
+	bool more = true;
+
+	while (more)
+	{
+		unsigned sendLength = 0;
+
+		if (requested != 0)
+		{
+			const auto maxLength = std::min<std::uint64_t>(requested, sendBuffer.size() - 3);
+			std::size_t length = 0;
+
+			if (!sourceEnded)
+			{
+				length = source(std::as_writable_bytes(std::span{sendBuffer}.subspan(3, maxLength)));
+
+				if (length > maxLength)
+					throw std::out_of_range{"ServiceManager::restoreFrom source returned too many bytes"};
+
+				sourceEnded = length == 0;
+				statistics.bytes += length;
+			}
+
+			sendBuffer[0] = isc_info_svc_line;
+			sendBuffer[1] = static_cast<std::uint8_t>(length & 0xFF);
+			sendBuffer[2] = static_cast<std::uint8_t>((length >> 8) & 0xFF);
+			sendLength = static_cast<unsigned>(length + 3);
+		}
+
+		handle->query(&statusWrapper, sendLength, sendBuffer.data(), sizeof(items), items,
+			static_cast<unsigned>(buffer.size()), buffer.data());
+
+		requested = 0;
+		more = false;
+
+		const auto* ptr = buffer.data();
+		const auto* const end = ptr + buffer.size();
+
+		while (ptr < end && *ptr != isc_info_end)
+		{
+			const auto item = *ptr++;
+
+			if (item == isc_info_truncated || item == isc_info_data_not_ready)
+			{
+				more = true;
+				continue;
+			}
+
+			if (ptr + 2 > end)
+				throw FbCppException("ServiceManager::restoreFrom malformed response");
+
+			const auto length = static_cast<std::uint16_t>((ptr[0]) | (ptr[1] << 8));
+			ptr += 2;
+
+			if (ptr + length > end)
+				throw FbCppException("ServiceManager::restoreFrom invalid length");
+
+			switch (item)
+			{
+				case isc_info_svc_stdin:
+					for (std::uint16_t i = 0; i < length; ++i)
+						requested |= static_cast<std::uint64_t>(ptr[i]) << (8u * i);
+
+					if (requested != 0)
+						more = true;
+
+					break;
+
+				case isc_info_svc_line:
+					if (length != 0)
+					{
+						if (output)
+							output(std::string_view{reinterpret_cast<const char*>(ptr), length});
+
+						more = true;
+					}
+
+					break;
+
+				default:
+					throw FbCppException("ServiceManager::restoreFrom unexpected item");
+			}
+
+			ptr += length;
+		}
+	}
+
+	statistics.elapsed = std::chrono::steady_clock::now() - startTime;
+	return statistics;
+}
+
+FbUniquePtr<fb::IXpbBuilder> ServiceManager::buildBackup(const BackupOptions& options, const std::string& backupFile)
+{
+	auto builder = newStartBuilder(client, statusWrapper, isc_action_svc_backup);
+	builder->insertString(&statusWrapper, isc_spb_dbname, options.getDatabase().c_str());
+	builder->insertString(&statusWrapper, isc_spb_bkp_file, backupFile.c_str());
+
+	if (options.getNoGarbageCollect())
+		builder->insertInt(&statusWrapper, isc_spb_options, isc_spb_bkp_no_garbage_collect);
+
+	if (const auto parallelWorkers = options.getParallelWorkers().value_or(0); parallelWorkers != 0)
+	{
+#ifdef isc_spb_bkp_parallel_workers
+		builder->insertInt(&statusWrapper, isc_spb_bkp_parallel_workers, static_cast<int>(parallelWorkers));
+#else
+		throw FbCppException("Parallel workers require Firebird 5.0 client headers");
+#endif
+	}
+
+	return builder;
+}
+
+FbUniquePtr<fb::IXpbBuilder> ServiceManager::buildRestore(const RestoreOptions& options, const std::string& backupFile)
+{
+	auto builder = newStartBuilder(client, statusWrapper, isc_action_svc_restore);
+	builder->insertString(&statusWrapper, isc_spb_bkp_file, backupFile.c_str());
+	builder->insertString(&statusWrapper, isc_spb_dbname, options.getDatabase().c_str());
+	builder->insertInt(
+		&statusWrapper, isc_spb_options, options.getReplace() ? isc_spb_res_replace : isc_spb_res_create);
+
+	if (options.getVerbose())
+		builder->insertTag(&statusWrapper, isc_spb_verbose);
+
+	if (const auto parallelWorkers = options.getParallelWorkers().value_or(0); parallelWorkers != 0)
+	{
+#ifdef isc_spb_res_parallel_workers
+		builder->insertInt(&statusWrapper, isc_spb_res_parallel_workers, static_cast<int>(parallelWorkers));
+#else
+		throw FbCppException("Parallel workers require Firebird 5.0 client headers");
+#endif
+	}
+
+	return builder;
+}
+
+void ServiceManager::sweep(const std::string& database, unsigned parallelWorkers)
+{
+	assert(isValid());
+
+	auto builder = newStartBuilder(client, statusWrapper, isc_action_svc_repair);
+	builder->insertString(&statusWrapper, isc_spb_dbname, database.c_str());
+	builder->insertInt(&statusWrapper, isc_spb_options, isc_spb_rpr_sweep_db);
+
+	if (parallelWorkers != 0)
+	{
+#ifdef isc_spb_rpr_par_workers
+		builder->insertInt(&statusWrapper, isc_spb_rpr_par_workers, static_cast<int>(parallelWorkers));
+#else
+		throw FbCppException("Parallel workers require Firebird 5.0 client headers");
+#endif
+	}
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+	readOutput({});
+}
+
+void ServiceManager::validate(const std::string& database, const OutputCallback& output)
+{
+	assert(isValid());
+
+	auto builder = newStartBuilder(client, statusWrapper, isc_action_svc_validate);
+	builder->insertString(&statusWrapper, isc_spb_dbname, database.c_str());
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+	readOutput(output);
+}
+
+void ServiceManager::getStatistics(const std::string& database, const OutputCallback& output)
+{
+	assert(isValid());
+
+	auto builder = newStartBuilder(client, statusWrapper, isc_action_svc_db_stats);
+	builder->insertString(&statusWrapper, isc_spb_dbname, database.c_str());
+	builder->insertInt(&statusWrapper, isc_spb_options, isc_spb_sts_data_pages | isc_spb_sts_idx_pages);
+
+	start(std::span{builder->getBuffer(&statusWrapper), builder->getBufferLength(&statusWrapper)});
+	readOutput(output);
+}
+
+void ServiceManager::start(std::span<const std::uint8_t> spb)
+{
+	handle->start(&statusWrapper, static_cast<unsigned>(spb.size()), spb.data());
+}
+
+void ServiceManager::readOutput(const OutputCallback& output)
+{
+	readToEof(
+		[&](std::span<const std::uint8_t> data)
+		{
+			if (output)
+				output(std::string_view{reinterpret_cast<const char*>(data.data()), data.size()});
+		});
+}
+
+void ServiceManager::readToEof(const std::function<void(std::span<const std::uint8_t> data)>& consumer)
+{
+	// isc_info_svc_to_eof returns whatever output is available, up to the buffer size, and waits for
+	// more while the task runs. Errors of the task are raised by query() once it finishes.
+	const std::uint8_t items[] = {isc_info_svc_to_eof};
+
+	if (buffer.empty())
+		buffer.resize(QUERY_BUFFER_SIZE);
+
+	bool more = true;
+
+	while (more)
+	{
+		handle->query(&statusWrapper, 0, nullptr, sizeof(items), items, static_cast<unsigned>(buffer.size()),
+			buffer.data());
+
+		more = false;
+
+		const auto* ptr = buffer.data();
+		const auto* const end = ptr + buffer.size();
+
+		while (ptr < end && *ptr != isc_info_end)
+		{
+			switch (*ptr++)
+			{
+				case isc_info_svc_to_eof:
+				{
+					if (ptr + 2 > end)
+						throw FbCppException("ServiceManager output malformed response");
+
+					const auto length = static_cast<std::uint16_t>((ptr[0]) | (ptr[1] << 8));
+					ptr += 2;
+
+					if (ptr + length > end)
+						throw FbCppException("ServiceManager output invalid length");
+
+					if (length != 0)
+					{
+						consumer(std::span{ptr, length});
+						more = true;
+					}
+
+					ptr += length;
+					break;
+				}
+
+				case isc_info_truncated:
+				case isc_info_data_not_ready:
+					more = true;
+					break;
+
+				default:
+					throw FbCppException("ServiceManager output unexpected item");
+			}
+		}
+	}
+}
@@ -0,0 +1,513 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_SERVICE_MANAGER_H
+#define FBCPP_SERVICE_MANAGER_H
+
+#include "fb-cpp_api.h"
+#include "fb-api.h"
+#include "SmartPtrs.h"
+#include "Exception.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Client;
+
+	///
+	/// Represents options used when creating a ServiceManager object.
+	///
+	class ServiceManagerOptions final
+	{
+	public:
+		///
+		/// Returns the server to connect to.
+		///
+		const std::optional<std::string>& getServer() const
+		{
+			return server;
+		}
+
+		///
+		/// Sets the server to connect to, as `host` or `host/port`.
+		/// Without a server, the local (or embedded) service manager is used.
+		///
+		ServiceManagerOptions& setServer(const std::string& value)
+		{
+			server = value;
+			return *this;
+		}
+
+		///
+		/// Returns the user name which will be used to connect to the service manager.
+		///
+		const std::optional<std::string>& getUserName() const
+		{
+			return userName;
+		}
+
+		///
+		/// Sets the user name which will be used to connect to the service manager.
+		///
+		ServiceManagerOptions& setUserName(const std::string& value)
+		{
+			userName = value;
+			return *this;
+		}
+
+		///
+		/// Returns the password which will be used to connect to the service manager.
+		///
+		const std::optional<std::string>& getPassword() const
+		{
+			return password;
+		}
+
+		///
+		/// Sets the password which will be used to connect to the service manager.
+		///
+		ServiceManagerOptions& setPassword(const std::string& value)
+		{
+			password = value;
+			return *this;
+		}
+
+		///
+		/// Returns the role which will be used to connect to the service manager.
+		///
+		const std::optional<std::string>& getRole() const
+		{
+			return role;
+		}
+
+		///
+		/// Sets the role which will be used to connect to the service manager.
+		///
+		ServiceManagerOptions& setRole(const std::string& value)
+		{
+			role = value;
+			return *this;
+		}
+
+	private:
+		std::optional<std::string> server;
+		std::optional<std::string> userName;
+		std::optional<std::string> password;
+		std::optional<std::string> role;
+	};
+
+	///
+	/// Represents options of ServiceManager::backup().
+	///
+	class BackupOptions final
+	{
+	public:
+		///
+		/// Returns the path of the database to back up, as seen by the server.
+		///
+		const std::string& getDatabase() const
+		{
+			return database;
+		}
+
+		///
+		/// Sets the path of the database to back up, as seen by the server.
+		///
+		BackupOptions& setDatabase(const std::string& value)
+		{
+			database = value;
+			return *this;
+		}
+
+		///
+		/// Returns the path of the backup file, as seen by the server.
+		///
+		const std::string& getBackupFile() const
+		{
+			return backupFile;
+		}
+
+		///
+		/// Sets the path of the backup file, as seen by the server.
+		///
+		BackupOptions& setBackupFile(const std::string& value)
+		{
+			backupFile = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of parallel workers used by the backup.
+		///
+		const std::optional<unsigned>& getParallelWorkers() const
+		{
+			return parallelWorkers;
+		}
+
+		///
+		/// Sets the number of parallel workers used by the backup (Firebird 5.0+).
+		///
+		BackupOptions& setParallelWorkers(unsigned value)
+		{
+			parallelWorkers = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the backup reports each processed object.
+		///
+		bool getVerbose() const
+		{
+			return verbose;
+		}
+
+		///
+		/// Sets whether the backup reports each processed object to the output callback.
+		///
+		BackupOptions& setVerbose(bool value)
+		{
+			verbose = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether garbage collection is skipped during the backup.
+		///
+		bool getNoGarbageCollect() const
+		{
+			return noGarbageCollect;
+		}
+
+		///
+		/// Sets whether garbage collection is skipped during the backup, which makes it faster.
+		///
+		BackupOptions& setNoGarbageCollect(bool value)
+		{
+			noGarbageCollect = value;
+			return *this;
+		}
+
+	private:
+		std::string database;
+		std::string backupFile;
+		std::optional<unsigned> parallelWorkers;
+		bool verbose = false;
+		bool noGarbageCollect = false;
+	};
+
+	///
+	/// Represents options of ServiceManager::restore().
+	///
+	class RestoreOptions final
+	{
+	public:
+		///
+		/// Returns the path of the backup file, as seen by the server.
+		///
+		const std::string& getBackupFile() const
+		{
+			return backupFile;
+		}
+
+		///
+		/// Sets the path of the backup file, as seen by the server.
+		///
+		RestoreOptions& setBackupFile(const std::string& value)
+		{
+			backupFile = value;
+			return *this;
+		}
+
+		///
+		/// Returns the path of the database to create, as seen by the server.
+		///
+		const std::string& getDatabase() const
+		{
+			return database;
+		}
+
+		///
+		/// Sets the path of the database to create, as seen by the server.
+		///
+		RestoreOptions& setDatabase(const std::string& value)
+		{
+			database = value;
+			return *this;
+		}
+
+		///
+		/// Returns the number of parallel workers used by the restore.
+		///
+		const std::optional<unsigned>& getParallelWorkers() const
+		{
+			return parallelWorkers;
+		}
+
+		///
+		/// Sets the number of parallel workers used by the restore (Firebird 5.0+).
+		///
+		RestoreOptions& setParallelWorkers(unsigned value)
+		{
+			parallelWorkers = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether the restore reports each processed object.
+		///
+		bool getVerbose() const
+		{
+			return verbose;
+		}
+
+		///
+		/// Sets whether the restore reports each processed object to the output callback.
+		///
+		RestoreOptions& setVerbose(bool value)
+		{
+			verbose = value;
+			return *this;
+		}
+
+		///
+		/// Returns whether an existing database is replaced.
+		///
+		bool getReplace() const
+		{
+			return replace;
+		}
+
+		///
+		/// Sets whether an existing database is replaced instead of failing the restore.
+		///
+		RestoreOptions& setReplace(bool value)
+		{
+			replace = value;
+			return *this;
+		}
+
+	private:
+		std::string backupFile;
+		std::string database;
+		std::optional<unsigned> parallelWorkers;
+		bool verbose = false;
+		bool replace = false;
+	};
+
+	///
+	/// Amount of backup data moved by ServiceManager::backupTo() or ServiceManager::restoreFrom().
+	///
+	struct ServiceTransferStatistics final
+	{
+		///
+		/// Number of backup bytes transferred.
+		///
+		std::uint64_t bytes = 0;
+
+		///
+		/// Time taken by the whole task.
+		///
+		std::chrono::nanoseconds elapsed{};
+
+		///
+		/// Returns the average throughput of the task.
+		///
+		double getBytesPerSecond() const noexcept
+		{
+			return elapsed.count() > 0 ? static_cast<double>(bytes) * 1e9 / static_cast<double>(elapsed.count()) : 0;
+		}
+	};
+
+	///
+	/// @brief Runs maintenance tasks through the Firebird service manager.
+	///
+	/// Each task blocks until the server finishes it. Text produced by the task is handed to the
+	/// output callback as soon as the server sends it, in chunks that are not necessarily whole lines,
+	/// so memory use does not depend on the amount of output.
+	/// Like Attachment, it reuses one status object for its calls, so its methods must not run concurrently.
+	///
+	class FBCPP_API ServiceManager final
+	{
+	public:
+		///
+		/// Function receiving the text output of a task.
+		///
+		using OutputCallback = std::function<void(std::string_view text)>;
+
+		///
+		/// Function receiving the next chunk of a backup streamed by backupTo().
+		///
+		using BackupSink = std::function<void(std::span<const std::byte> data)>;
+
+		///
+		/// Function filling `buffer` with the next chunk of a backup consumed by restoreFrom().
+		/// It returns the number of bytes written to `buffer`, or `0` at the end of the backup.
+		///
+		using BackupSource = std::function<std::size_t(std::span<std::byte> buffer)>;
+
+	public:
+		///
+		/// Connects to the service manager using the specified Client object and options.
+		///
+		explicit ServiceManager(Client& client, const ServiceManagerOptions& options = {});
+
+		///
+		/// Move constructor.
+		/// A moved ServiceManager object becomes invalid.
+		///
+		ServiceManager(ServiceManager&& o) noexcept
+			: client{o.client},
+			  status{std::move(o.status)},
+			  statusWrapper{std::move(o.statusWrapper)},
+			  handle{std::move(o.handle)},
+			  buffer{std::move(o.buffer)},
+			  sendBuffer{std::move(o.sendBuffer)}
+		{
+		}
+
+		ServiceManager& operator=(ServiceManager&&) = delete;
+
+		ServiceManager(const ServiceManager&) = delete;
+		ServiceManager& operator=(const ServiceManager&) = delete;
+
+		///
+		/// Disconnects from the service manager.
+		///
+		~ServiceManager() noexcept
+		{
+			if (isValid())
+			{
+				try
+				{
+					disconnect();
+				}
+				catch (...)
+				{
+					// swallow
+				}
+			}
+		}
+
+	public:
+		///
+		/// Returns whether the ServiceManager object is valid.
+		///
+		bool isValid() const noexcept
+		{
+			return handle != nullptr;
+		}
+
+		///
+		/// Returns the Client object reference used to create this ServiceManager object.
+		///
+		Client& getClient() noexcept
+		{
+			return client;
+		}
+
+		///
+		/// Returns the internal Firebird handle.
+		///
+		FbRef<fb::IService> getHandle() noexcept
+		{
+			return handle;
+		}
+
+		///
+		/// Backs up a database to a file on the server.
+		///
+		void backup(const BackupOptions& options, const OutputCallback& output = {});
+
+		///
+		/// Restores a database from a backup file on the server.
+		///
+		void restore(const RestoreOptions& options, const OutputCallback& output = {});
+
+		///
+		/// @brief Backs up a database to `sink`, without a backup file on the server.
+		/// The backup file and verbose settings of `options` are not used.
+		/// Data arrives in chunks of at most 64 KiB, so memory use does not depend on the database size.
+		///
+		ServiceTransferStatistics backupTo(const BackupOptions& options, const BackupSink& sink);
+
+		///
+		/// @brief Restores a database from the backup read from `source`, without a backup file on the server.
+		/// The backup file setting of `options` is not used. `source` is asked for at most 64 KiB at a time.
+		///
+		ServiceTransferStatistics restoreFrom(
+			const RestoreOptions& options, const BackupSource& source, const OutputCallback& output = {});
+
+		///
+		/// @brief Sweeps a database.
+		/// @param parallelWorkers Number of parallel workers (Firebird 5.0+); `0` uses the server default.
+		///
+		void sweep(const std::string& database, unsigned parallelWorkers = 0);
+
+		///
+		/// Validates a database while it stays online, reporting the problems found to `output`.
+		///
+		void validate(const std::string& database, const OutputCallback& output = {});
+
+		///
+		/// Reports the header, data page and index statistics of a database to `output`.
+		///
+		void getStatistics(const std::string& database, const OutputCallback& output);
+
+		///
+		/// Disconnects from the service manager.
+		///
+		void disconnect();
+
+	private:
+		void start(std::span<const std::uint8_t> spb);
+		void readOutput(const OutputCallback& output);
+		void readToEof(const std::function<void(std::span<const std::uint8_t> data)>& consumer);
+		FbUniquePtr<fb::IXpbBuilder> buildBackup(const BackupOptions& options, const std::string& backupFile);
+		FbUniquePtr<fb::IXpbBuilder> buildRestore(const RestoreOptions& options, const std::string& backupFile);
+
+	private:
+		Client& client;
+		FbUniquePtr<fb::IStatus> status;
+		impl::StatusWrapper statusWrapper;
+		FbRef<fb::IService> handle;
+		std::vector<std::uint8_t> buffer;
+		std::vector<std::uint8_t> sendBuffer;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_SERVICE_MANAGER_H
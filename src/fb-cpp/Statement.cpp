@@ -26,22 +26,88 @@
 #include "Transaction.h"
 #include "Attachment.h"
 #include "Client.h"
+#include "Instrumentation.h"
+#include "firebird/impl/inf_pub.h"
+#include <algorithm>
+#include <cstddef>
+#include <span>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
 
 
+namespace
+{
+	template <typename S>
+	concept HasMaxInlineBlobSize = requires(S* statement, StatusWrapper* statusWrapper) {
+		statement->setMaxInlineBlobSize(statusWrapper, 0u);
+	};
+
+	// Inline blobs exist since Firebird 5.0.3. Older headers lack the method and older clients report a
+	// version error for it; in both cases blobs are simply read with separate requests.
+	template <typename S>
+	void setMaxInlineBlobSize(S* statement, StatusWrapper& statusWrapper, unsigned size)
+	{
+		if constexpr (HasMaxInlineBlobSize<S>)
+		{
+			try
+			{
+				statement->setMaxInlineBlobSize(&statusWrapper, size);
+			}
+			catch (const DatabaseException&)
+			{
+				// not supported by the client library
+			}
+		}
+	}
+
+	template <typename Container>
+	void appendBlob(Blob& blob, Container& result, std::size_t expectedSize)
+	{
+		// One byte more than expected, so a blob of exactly the expected size is read with a single short read.
+		auto chunkSize = expectedSize + 1;
+		auto filled = result.size();
+
+		while (true)
+		{
+			result.resize(filled + chunkSize);
+
+			const auto readNow = blob.read(std::as_writable_bytes(std::span{result}.subspan(filled)));
+			filled += readNow;
+
+			if (readNow < chunkSize)
+				break;
+
+			chunkSize *= 2;
+		}
+
+		result.resize(filled);
+	}
+
+	bool reportFetch(InstrumentationTimer& timer, bool found, std::size_t messageSize) noexcept
+	{
+		timer.reportStatement(StatementOperation::FETCH, found ? 1u : 0u, found ? messageSize : 0u);
+		return found;
+	}
+}  // namespace
+
 Statement::Statement(
 	Attachment& attachment, Transaction& transaction, std::string_view sql, const StatementOptions& options)
 	: attachment{attachment},
 	  status{attachment.getClient().newStatus()},
 	  statusWrapper{attachment.getClient(), status.get()},
 	  calendarConverter{attachment.getClient(), &statusWrapper},
-	  numericConverter{attachment.getClient(), &statusWrapper}
+	  numericConverter{attachment.getClient(), &statusWrapper},
+	  fetchBufferRows{options.getFetchBufferRows()},
+	  inlineBlobThreshold{options.getInlineBlobThreshold()},
+	  cursorType{options.getCursorType()},
+	  instrumentation{attachment.getInstrumentation()}
 {
 	assert(attachment.isValid());
 	assert(transaction.isValid());
 
+	InstrumentationTimer timer{instrumentation};
+
 	unsigned flags = fb::IStatement::PREPARE_PREFETCH_METADATA;
 
 	if (options.getPrefetchLegacyPlan())
@@ -79,6 +145,9 @@ Statement::Statement(
 			break;
 	}
 
+	if (inlineBlobThreshold != 0)
+		setMaxInlineBlobSize(statementHandle.get(), statusWrapper, inlineBlobThreshold);
+
 	const auto processMetadata = [&](FbRef<fb::IMessageMetadata>& metadata, std::vector<Descriptor>& descriptors,
 									 std::vector<std::byte>& message)
 	{
@@ -169,12 +238,22 @@ Statement::Statement(
 
 	outMetadata.reset(statementHandle->getOutputMetadata(&statusWrapper));
 	processMetadata(outMetadata, outDescriptors, outMessage);
+
+	currentOutMessage = outMessage.data();
+
+	timer.reportStatement(StatementOperation::PREPARE, 0u, 0u);
 }
 
 void Statement::free()
 {
 	assert(isValid());
 
+	if (batchHandle)
+	{
+		batchHandle->close(&statusWrapper);
+		batchHandle.reset();
+	}
+
 	if (resultSetHandle)
 	{
 		resultSetHandle->close(&statusWrapper);
@@ -199,11 +278,86 @@ std::string Statement::getPlan()
 	return statementHandle->getPlan(&statusWrapper, true);
 }
 
+RecordCounts Statement::getRecordCounts()
+{
+	assert(isValid());
+
+	const std::uint8_t items[] = {isc_info_sql_records};
+	std::uint8_t buffer[64]{};
+
+	statementHandle->getInfo(&statusWrapper, sizeof(items), items, sizeof(buffer), buffer);
+
+	const auto readInteger = [](const std::uint8_t* ptr, std::uint16_t length)
+	{
+		std::uint64_t result = 0;
+
+		for (std::uint16_t i = 0; i < length; ++i)
+			result |= static_cast<std::uint64_t>(ptr[i]) << (8u * i);
+
+		return result;
+	};
+
+	const auto* ptr = buffer;
+	const auto* const end = buffer + sizeof(buffer);
+
+	if (*ptr == isc_info_truncated || *ptr == isc_info_error)
+		throw FbCppException("Statement::getRecordCounts not supported by the server");
+
+	if (*ptr++ != isc_info_sql_records || ptr + 2 > end)
+		throw FbCppException("Statement::getRecordCounts malformed response");
+
+	ptr += 2;
+
+	RecordCounts counts;
+
+	while (ptr < end && *ptr != isc_info_end)
+	{
+		const auto item = *ptr++;
+
+		if (ptr + 2 > end)
+			throw FbCppException("Statement::getRecordCounts malformed response");
+
+		const auto itemLength = static_cast<std::uint16_t>((ptr[0]) | (ptr[1] << 8));
+		ptr += 2;
+
+		if (ptr + itemLength > end)
+			throw FbCppException("Statement::getRecordCounts invalid length");
+
+		switch (item)
+		{
+			case isc_info_req_select_count:
+				counts.selected = readInteger(ptr, itemLength);
+				break;
+
+			case isc_info_req_insert_count:
+				counts.inserted = readInteger(ptr, itemLength);
+				break;
+
+			case isc_info_req_update_count:
+				counts.updated = readInteger(ptr, itemLength);
+				break;
+
+			case isc_info_req_delete_count:
+				counts.deleted = readInteger(ptr, itemLength);
+				break;
+
+			default:
+				break;
+		}
+
+		ptr += itemLength;
+	}
+
+	return counts;
+}
+
 bool Statement::execute(Transaction& transaction)
 {
 	assert(isValid());
 	assert(transaction.isValid());
 
+	InstrumentationTimer timer{instrumentation};
+
 	if (resultSetHandle)
 	{
 		resultSetHandle->close(&statusWrapper);
@@ -211,6 +365,8 @@ bool Statement::execute(Transaction& transaction)
 	}
 
 	const auto outMessageData = outMessage.data();
+	currentOutMessage = outMessageData;
+	pendingRow = false;
 
 	if (outMessageData)
 	{
@@ -222,58 +378,259 @@ bool Statement::execute(Transaction& transaction)
 	{
 		case StatementType::SELECT:
 		case StatementType::SELECT_FOR_UPDATE:
+			cursorTransaction = &transaction;
 			resultSetHandle.reset(statementHandle->openCursor(&statusWrapper, transaction.getHandle().get(),
-				inMetadata.get(), inMessage.data(), outMetadata.get(), 0));
-			return resultSetHandle->fetchNext(&statusWrapper, outMessageData) == fb::IStatus::RESULT_OK;
+				inMetadata.get(), inMessage.data(), outMetadata.get(), static_cast<unsigned>(cursorType)));
+			pendingRow = resultSetHandle->fetchNext(&statusWrapper, outMessageData) == fb::IStatus::RESULT_OK;
+			timer.reportStatement(StatementOperation::EXECUTE, pendingRow ? 1u : 0u,
+				inMessage.size() + (pendingRow ? outMessage.size() : 0u));
+			return pendingRow;
 
 		default:
+			cursorTransaction = &transaction;
 			statementHandle->execute(&statusWrapper, transaction.getHandle().get(), inMetadata.get(), inMessage.data(),
 				outMetadata.get(), outMessageData);
+			timer.reportStatement(StatementOperation::EXECUTE, 0u, inMessage.size() + outMessage.size());
 			return true;
 	}
 }
 
+void Statement::readBlob(const ISC_QUAD& blobId, std::string& result)
+{
+	assert(cursorTransaction);
+
+	BlobId id;
+	id.id = blobId;
+
+	Blob blob{attachment, *cursorTransaction, id};
+	appendBlob(blob, result, inlineBlobThreshold);
+	blob.close();
+}
+
+void Statement::readBlob(const ISC_QUAD& blobId, std::vector<std::byte>& result)
+{
+	assert(cursorTransaction);
+
+	BlobId id;
+	id.id = blobId;
+
+	Blob blob{attachment, *cursorTransaction, id};
+	appendBlob(blob, result, inlineBlobThreshold);
+	blob.close();
+}
+
+void Statement::closeCursor()
+{
+	assert(isValid());
+
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	if (resultSetHandle)
+	{
+		resultSetHandle->close(&statusWrapper);
+		resultSetHandle.reset();
+	}
+}
+
+void Statement::addBatch()
+{
+	assert(isValid());
+
+	if (!batchHandle)
+	{
+		auto& client = attachment.getClient();
+
+		auto bpbBuilder = fbUnique(client.getUtil()->getXpbBuilder(&statusWrapper, fb::IXpbBuilder::BATCH, nullptr, 0));
+		bpbBuilder->insertInt(&statusWrapper, fb::IBatch::TAG_MULTIERROR, 1);
+		bpbBuilder->insertInt(&statusWrapper, fb::IBatch::TAG_RECORD_COUNTS, 1);
+
+		batchHandle.reset(statementHandle->createBatch(&statusWrapper, inMetadata.get(),
+			bpbBuilder->getBufferLength(&statusWrapper), bpbBuilder->getBuffer(&statusWrapper)));
+	}
+
+	batchHandle->add(&statusWrapper, 1, inMessage.data());
+}
+
+BatchCompletionState Statement::executeBatch(Transaction& transaction)
+{
+	assert(isValid());
+	assert(transaction.isValid());
+
+	if (!batchHandle)
+		return BatchCompletionState{};
+
+	auto& client = attachment.getClient();
+
+	InstrumentationTimer timer{instrumentation};
+
+	const auto completionState = fbUnique(batchHandle->execute(&statusWrapper, transaction.getHandle().get()));
+
+	const auto size = completionState->getSize(&statusWrapper);
+
+	timer.reportStatement(StatementOperation::EXECUTE_BATCH, size, std::uint64_t{size} * inMessage.size());
+
+	std::vector<int> states;
+	states.reserve(size);
+
+	for (unsigned pos = 0u; pos < size; ++pos)
+		states.push_back(completionState->getState(&statusWrapper, pos));
+
+	std::vector<BatchRowError> errors;
+	const auto errorStatus = client.newStatus();
+
+	for (auto pos = completionState->findError(&statusWrapper, 0u);
+		 pos != fb::IBatchCompletionState::NO_MORE_ERRORS; pos = completionState->findError(&statusWrapper, pos + 1))
+	{
+		errorStatus->init();
+		completionState->getStatus(&statusWrapper, errorStatus.get(), pos);
+
+		errors.push_back(BatchRowError{
+			.index = pos,
+			.message = DatabaseException{client, errorStatus->getErrors()}.what(),
+		});
+	}
+
+	return BatchCompletionState{std::move(states), std::move(errors)};
+}
+
+void Statement::cancelBatch()
+{
+	assert(isValid());
+
+	if (batchHandle)
+		batchHandle->cancel(&statusWrapper);
+}
+
 bool Statement::fetchNext()
 {
 	assert(isValid());
 
-	return resultSetHandle && resultSetHandle->fetchNext(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	InstrumentationTimer timer{instrumentation};
+	const auto found =
+		resultSetHandle && resultSetHandle->fetchNext(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+
+	return reportFetch(timer, found, outMessage.size());
 }
 
 bool Statement::fetchPrior()
 {
 	assert(isValid());
 
-	return resultSetHandle && resultSetHandle->fetchPrior(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	InstrumentationTimer timer{instrumentation};
+	const auto found =
+		resultSetHandle && resultSetHandle->fetchPrior(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+
+	return reportFetch(timer, found, outMessage.size());
 }
 
 bool Statement::fetchFirst()
 {
 	assert(isValid());
 
-	return resultSetHandle && resultSetHandle->fetchFirst(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	InstrumentationTimer timer{instrumentation};
+	const auto found =
+		resultSetHandle && resultSetHandle->fetchFirst(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+
+	return reportFetch(timer, found, outMessage.size());
 }
 
 bool Statement::fetchLast()
 {
 	assert(isValid());
 
-	return resultSetHandle && resultSetHandle->fetchLast(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	InstrumentationTimer timer{instrumentation};
+	const auto found =
+		resultSetHandle && resultSetHandle->fetchLast(&statusWrapper, outMessage.data()) == fb::IStatus::RESULT_OK;
+
+	return reportFetch(timer, found, outMessage.size());
 }
 
 bool Statement::fetchAbsolute(unsigned position)
 {
 	assert(isValid());
 
-	return resultSetHandle &&
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	InstrumentationTimer timer{instrumentation};
+	const auto found = resultSetHandle &&
 		resultSetHandle->fetchAbsolute(&statusWrapper, static_cast<int>(position), outMessage.data()) ==
-		fb::IStatus::RESULT_OK;
+			fb::IStatus::RESULT_OK;
+
+	return reportFetch(timer, found, outMessage.size());
 }
 
 bool Statement::fetchRelative(int offset)
 {
 	assert(isValid());
 
-	return resultSetHandle &&
+	currentOutMessage = outMessage.data();
+	pendingRow = false;
+
+	InstrumentationTimer timer{instrumentation};
+	const auto found = resultSetHandle &&
 		resultSetHandle->fetchRelative(&statusWrapper, offset, outMessage.data()) == fb::IStatus::RESULT_OK;
+
+	return reportFetch(timer, found, outMessage.size());
+}
+
+std::span<const RowView> Statement::fetchBlock(unsigned maxRows)
+{
+	assert(isValid());
+
+	fetchBufferViews.clear();
+
+	if (!resultSetHandle || maxRows == 0u)
+		return {};
+
+	const auto capacity = std::max(fetchBufferRows, 1u);
+	const auto limit = std::min(capacity, maxRows);
+
+	if (fetchBuffer.empty())
+	{
+		constexpr auto alignment = alignof(std::max_align_t);
+		fetchBufferStride = (outMessage.size() + alignment - 1) / alignment * alignment;
+		fetchBuffer.resize(fetchBufferStride * capacity);
+		fetchBufferViews.reserve(capacity);
+	}
+
+	InstrumentationTimer timer{instrumentation};
+	unsigned count = 0u;
+	unsigned fetched = 0u;
+
+	if (pendingRow)
+	{
+		std::copy(outMessage.begin(), outMessage.end(), fetchBuffer.begin());
+		pendingRow = false;
+		++count;
+	}
+
+	while (count < limit &&
+		resultSetHandle->fetchNext(&statusWrapper, &fetchBuffer[count * fetchBufferStride]) == fb::IStatus::RESULT_OK)
+	{
+		++count;
+		++fetched;
+	}
+
+	timer.reportStatement(StatementOperation::FETCH, fetched, std::uint64_t{fetched} * outMessage.size());
+
+	for (unsigned index = 0u; index < count; ++index)
+		fetchBufferViews.emplace_back(&fetchBuffer[index * fetchBufferStride]);
+
+	currentOutMessage = count > 0u ? fetchBufferViews.front().getMessage() : outMessage.data();
+
+	return fetchBufferViews;
 }
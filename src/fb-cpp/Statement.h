@@ -46,6 +46,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -68,6 +69,26 @@ namespace fbcpp
 {
 	class Transaction;
 
+	template <typename T>
+	class RowRange;
+
+	///
+	/// @brief Selects how the cursor opened by Statement::execute() can move.
+	///
+	enum class CursorType : unsigned
+	{
+		///
+		/// Rows can only be fetched in order, with fetchNext() and fetchBlock().
+		///
+		FORWARD_ONLY = 0,
+
+		///
+		/// The cursor can also move backwards and to arbitrary positions, with fetchPrior(), fetchFirst(),
+		/// fetchLast(), fetchAbsolute() and fetchRelative(). The server materializes the result set for it.
+		///
+		SCROLLABLE = fb::IStatement::CURSOR_TYPE_SCROLLABLE
+	};
+
 	///
 	/// Represents options used when preparing a Statement.
 	///
@@ -112,9 +133,81 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// @brief Returns the number of rows held by the fetch buffer used by Statement::fetchBlock().
+		///
+		unsigned getFetchBufferRows() const
+		{
+			return fetchBufferRows;
+		}
+
+		///
+		/// @brief Sets the number of rows held by the fetch buffer used by Statement::fetchBlock().
+		/// @param value Number of row buffers to allocate; `0` keeps blocks of a single row.
+		/// @return Reference to this instance for fluent configuration.
+		///
+		StatementOptions& setFetchBufferRows(unsigned value)
+		{
+			fetchBufferRows = value;
+			return *this;
+		}
+
+		///
+		/// @brief Returns the size up to which blob values are expected to be small enough to fetch inline.
+		///
+		unsigned getInlineBlobThreshold() const
+		{
+			return inlineBlobThreshold;
+		}
+
+		///
+		/// @brief Lets Statement::getString() and Statement::getBytes() read BLOB columns, and asks the server to
+		/// send blobs up to `value` bytes together with the rows.
+		///
+		/// Servers and clients with inline blob support (Firebird 5.0.3+) then return small blobs without extra
+		/// round-trips. Otherwise each value is read by opening the blob, using `value` as the initial buffer size.
+		/// Larger blobs are read completely as well, just not inline.
+		///
+		/// @param value Size in bytes; `0` (default) keeps BLOB columns readable only through getBlobId().
+		/// @return Reference to this instance for fluent configuration.
+		///
+		StatementOptions& setInlineBlobThreshold(unsigned value)
+		{
+			inlineBlobThreshold = value;
+			return *this;
+		}
+
+		///
+		/// @brief Returns the type of the cursors opened by Statement::execute().
+		///
+		CursorType getCursorType() const
+		{
+			return cursorType;
+		}
+
+		///
+		/// @brief Sets the type of the cursors opened by Statement::execute().
+		/// @param value CursorType::SCROLLABLE to allow moving in any direction; CursorType::FORWARD_ONLY (default)
+		/// otherwise.
+		/// @return Reference to this instance for fluent configuration.
+		///
+		StatementOptions& setCursorType(CursorType value)
+		{
+			cursorType = value;
+			return *this;
+		}
+
+		///
+		/// @brief Compares all options, e.g. to match statements prepared with the same options.
+		///
+		bool operator==(const StatementOptions&) const noexcept = default;
+
 	private:
 		bool prefetchLegacyPlan = false;
 		bool prefetchPlan = false;
+		unsigned fetchBufferRows = 0;
+		unsigned inlineBlobThreshold = 0;
+		CursorType cursorType = CursorType::FORWARD_ONLY;
 	};
 
 	///
@@ -180,6 +273,161 @@ namespace fbcpp
 		SAVEPOINT = isc_info_sql_stmt_savepoint,
 	};
 
+	///
+	/// @brief Refers to a row stored in the fetch buffer of a Statement.
+	///
+	/// A view remains valid until the next call to Statement::fetchBlock() or until the statement is
+	/// re-executed or freed.
+	///
+	class RowView final
+	{
+	public:
+		///
+		/// @brief Creates a view over the output message of a fetched row.
+		///
+		explicit RowView(const std::byte* message) noexcept
+			: message{message}
+		{
+		}
+
+	public:
+		///
+		/// @brief Returns the raw output message of the row, laid out as described by the output descriptors.
+		///
+		const std::byte* getMessage() const noexcept
+		{
+			return message;
+		}
+
+	private:
+		const std::byte* message;
+	};
+
+	///
+	/// @brief Describes a row of a batch that failed to execute.
+	///
+	struct BatchRowError final
+	{
+		///
+		/// Zero-based position of the failed row in the batch.
+		///
+		unsigned index;
+
+		///
+		/// Formatted error message reported by the server for the row.
+		///
+		std::string message;
+	};
+
+	///
+	/// @brief Per-row outcome of a batch executed through Statement::executeBatch().
+	///
+	class BatchCompletionState final
+	{
+	public:
+		///
+		/// State reported for a row that failed to execute.
+		///
+		static constexpr int EXECUTE_FAILED = fb::IBatchCompletionState::EXECUTE_FAILED;
+
+		///
+		/// State reported for a row that succeeded without an affected records count.
+		///
+		static constexpr int SUCCESS_NO_INFO = fb::IBatchCompletionState::SUCCESS_NO_INFO;
+
+	public:
+		///
+		/// @brief Builds the completion state from row states and collected errors.
+		///
+		explicit BatchCompletionState(std::vector<int> states = {}, std::vector<BatchRowError> errors = {})
+			: states{std::move(states)},
+			  errors{std::move(errors)}
+		{
+		}
+
+	public:
+		///
+		/// @brief Returns the number of rows processed by the batch.
+		///
+		unsigned getSize() const noexcept
+		{
+			return static_cast<unsigned>(states.size());
+		}
+
+		///
+		/// @brief Returns the state of the given row: the number of affected records,
+		/// `EXECUTE_FAILED` or `SUCCESS_NO_INFO`.
+		///
+		int getState(unsigned index) const
+		{
+			if (index >= states.size())
+				throw std::out_of_range("index out of range");
+
+			return states[index];
+		}
+
+		///
+		/// @brief Returns the states of all rows, in the order they were added.
+		///
+		const std::vector<int>& getStates() const noexcept
+		{
+			return states;
+		}
+
+		///
+		/// @brief Returns the errors reported for failed rows.
+		///
+		const std::vector<BatchRowError>& getErrors() const noexcept
+		{
+			return errors;
+		}
+
+		///
+		/// @brief Reports whether any row of the batch failed.
+		///
+		bool hasErrors() const noexcept
+		{
+			for (const auto state : states)
+			{
+				if (state == EXECUTE_FAILED)
+					return true;
+			}
+
+			return !errors.empty();
+		}
+
+		///
+		/// @brief Returns the sum of affected records of all rows that reported a count.
+		///
+		std::uint64_t getAffectedRows() const noexcept
+		{
+			std::uint64_t total = 0;
+
+			for (const auto state : states)
+			{
+				if (state > 0)
+					total += static_cast<std::uint64_t>(state);
+			}
+
+			return total;
+		}
+
+	private:
+		std::vector<int> states;
+		std::vector<BatchRowError> errors;
+	};
+
+	///
+	/// @brief Records processed by the last execution of a statement, as reported by the server.
+	///
+	struct RecordCounts final
+	{
+		std::uint64_t selected = 0;
+		std::uint64_t inserted = 0;
+		std::uint64_t updated = 0;
+		std::uint64_t deleted = 0;
+	};
+
 	///
 	/// Prepares, executes, and fetches SQL statements against a Firebird attachment.
 	///
@@ -213,6 +461,17 @@ namespace fbcpp
 			  outMetadata{std::move(o.outMetadata)},
 			  outDescriptors{std::move(o.outDescriptors)},
 			  outMessage{std::move(o.outMessage)},
+			  batchHandle{std::move(o.batchHandle)},
+			  fetchBufferRows{o.fetchBufferRows},
+			  inlineBlobThreshold{o.inlineBlobThreshold},
+			  cursorType{o.cursorType},
+			  fetchBufferStride{o.fetchBufferStride},
+			  fetchBuffer{std::move(o.fetchBuffer)},
+			  fetchBufferViews{std::move(o.fetchBufferViews)},
+			  currentOutMessage{o.currentOutMessage},
+			  pendingRow{o.pendingRow},
+			  cursorTransaction{o.cursorTransaction},
+			  instrumentation{o.instrumentation},
 			  type{o.type}
 		{
 		}
@@ -296,6 +555,14 @@ namespace fbcpp
 			return type;
 		}
 
+		///
+		/// @brief Returns the type of the cursors opened by execute().
+		///
+		CursorType getCursorType() const noexcept
+		{
+			return cursorType;
+		}
+
 		///
 		/// @}
 		///
@@ -322,6 +589,14 @@ namespace fbcpp
 			return outDescriptors;
 		}
 
+		///
+		/// @brief Returns the size of the output message of a row, as referenced by RowView.
+		///
+		std::size_t getOutputMessageLength() const noexcept
+		{
+			return outMessage.size();
+		}
+
 		///
 		/// @}
 		///
@@ -341,6 +616,21 @@ namespace fbcpp
 		///
 		std::string getPlan();
 
+		///
+		/// @brief Retrieves the records processed by the last execution from the server.
+		/// For a cursor, selected records are counted as they are fetched.
+		///
+		RecordCounts getRecordCounts();
+
+		///
+		/// @brief Returns the number of records inserted, updated and deleted by the last execution.
+		///
+		std::uint64_t getAffectedRows()
+		{
+			const auto counts = getRecordCounts();
+			return counts.inserted + counts.updated + counts.deleted;
+		}
+
 		///
 		/// @brief Executes a prepared statement using the supplied transaction.
 		/// @param transaction Transaction that will own the execution context.
@@ -348,10 +638,44 @@ namespace fbcpp
 		///
 		bool execute(Transaction& transaction);
 
+		///
+		/// @name Batch execution
+		/// @{
+
+		///
+		/// @brief Appends the currently bound parameters as a new row of the pending batch.
+		///
+		/// The batch is created on first use from the prepared statement and reuses its input
+		/// message layout, so all parameter setters can be used to fill each row.
+		/// Blob parameters are not supported in batches.
+		///
+		void addBatch();
+
+		///
+		/// @brief Sends all rows added with addBatch() to the server in a single operation.
+		/// @param transaction Transaction that will own the execution context.
+		/// @return Per-row completion state. Row failures are reported there instead of thrown.
+		///
+		BatchCompletionState executeBatch(Transaction& transaction);
+
+		///
+		/// @brief Discards all rows added with addBatch() that were not executed yet.
+		///
+		void cancelBatch();
+
+		///
+		/// @}
+		///
+
 		///
 		/// @name Cursor movement
 		/// @{
 
+		///
+		/// @brief Closes the current result set, if any, keeping the statement prepared.
+		///
+		void closeCursor();
+
 		///
 		/// @brief Fetches the next row in the current result set.
 		///
@@ -359,29 +683,76 @@ namespace fbcpp
 
 		///
 		/// @brief Fetches the previous row in the current result set.
+		/// Requires a scrollable cursor, see StatementOptions::setCursorType().
 		///
 		bool fetchPrior();
 
 		///
 		/// @brief Positions the cursor on the first row.
+		/// Requires a scrollable cursor, see StatementOptions::setCursorType().
 		///
 		bool fetchFirst();
 
 		///
 		/// @brief Positions the cursor on the last row.
+		/// Requires a scrollable cursor, see StatementOptions::setCursorType().
 		///
 		bool fetchLast();
 
 		///
-		/// @brief Positions the cursor on the given absolute row number.
+		/// @brief Positions the cursor on the given absolute row number, starting from 1.
+		/// Requires a scrollable cursor, see StatementOptions::setCursorType().
 		///
 		bool fetchAbsolute(unsigned position);
 
 		///
 		/// @brief Moves the cursor by the requested relative offset.
+		/// Requires a scrollable cursor, see StatementOptions::setCursorType().
 		///
 		bool fetchRelative(int offset);
 
+		///
+		/// @brief Fetches the next block of rows into the fetch buffer.
+		///
+		/// The block holds up to StatementOptions::getFetchBufferRows() rows. When called right after
+		/// execute(), the block starts with the row already fetched by it. After the call, the result
+		/// reading methods refer to the first row of the block; use setCurrentRow() to select another one.
+		///
+		/// @param maxRows Maximum number of rows to fetch in this block.
+		/// @return Views of the fetched rows; empty when the result set is exhausted or there is none.
+		///
+		std::span<const RowView> fetchBlock(unsigned maxRows = std::numeric_limits<unsigned>::max());
+
+		///
+		/// @brief Executes the statement and returns an input range over its rows.
+		///
+		/// Each row is read into a single `T` owned by the range and reused for every row. Rows are fetched
+		/// through fetchBlock(), so StatementOptions::setFetchBufferRows() controls how many are fetched at once.
+		/// Defined in RowRange.h.
+		///
+		/// @tparam T An aggregate or tuple-like type mapped as with get<T>(), or the type of the single
+		/// output column.
+		///
+		template <typename T>
+		RowRange<T> rows(Transaction& transaction);
+
+		///
+		/// @brief Makes the result reading methods read from the given buffered row.
+		/// @param row Row view returned by the last call to fetchBlock().
+		///
+		void setCurrentRow(RowView row) noexcept
+		{
+			currentOutMessage = row.getMessage();
+		}
+
+		///
+		/// @brief Returns a view of the row currently read by the result reading methods.
+		///
+		RowView getCurrentRow() const noexcept
+		{
+			return RowView{currentOutMessage};
+		}
+
 		///
 		/// @}
 		///
@@ -1482,7 +1853,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			return *reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE;
 		}
@@ -1495,7 +1866,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1575,7 +1946,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1640,7 +2011,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1674,7 +2045,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1708,7 +2079,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1732,7 +2103,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1755,7 +2126,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1779,7 +2150,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1802,7 +2173,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1826,7 +2197,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1849,7 +2220,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1873,7 +2244,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1896,7 +2267,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1920,7 +2291,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1943,7 +2314,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -1966,73 +2337,182 @@ namespace fbcpp
 		/// @brief Reads a textual column, applying number-to-string conversions when needed.
 		///
 		std::optional<std::string> getString(unsigned index)
+		{
+			std::string value;
+
+			if (!getStringTo(index, value))
+				return std::nullopt;
+
+			return value;
+		}
+
+		///
+		/// @brief Reads a textual column without copying it.
+		/// @return A view into the current row buffer, valid until the next fetch, execute or `setCurrentRow`
+		/// call, or `std::nullopt` for NULL.
+		/// @throws FbCppException if the column is not a STRING column.
+		///
+		std::optional<std::string_view> getStringView(unsigned index)
 		{
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
 
 			const auto data = &message[descriptor.offset];
 
+			switch (descriptor.adjustedType)
+			{
+				case DescriptorAdjustedType::STRING:
+					return std::string_view{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+						*reinterpret_cast<const std::uint16_t*>(data)};
+
+				default:
+					throwInvalidType("std::string_view", descriptor.adjustedType);
+			}
+		}
+
+		///
+		/// @brief Appends the textual form of a column to a caller-owned string, as `getString` would return it.
+		/// Reusing the same string across cells avoids one allocation per value.
+		/// @return `false`, leaving `result` untouched, if the column is NULL.
+		///
+		bool getStringTo(unsigned index, std::string& result)
+		{
+			assert(isValid());
+
+			const auto& descriptor = getOutDescriptor(index);
+			const auto* const message = currentOutMessage;
+
+			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
+				return false;
+
+			const auto data = &message[descriptor.offset];
+
 			switch (descriptor.adjustedType)
 			{
 				case DescriptorAdjustedType::BOOLEAN:
-					return (message[descriptor.offset] != std::byte{0}) ? std::string{"true"} : std::string{"false"};
+					result += (message[descriptor.offset] != std::byte{0}) ? "true" : "false";
+					break;
 
 				case DescriptorAdjustedType::INT16:
-					return numericConverter.numberToString(
-						ScaledInt16{*reinterpret_cast<const std::int16_t*>(data), descriptor.scale});
+					numericConverter.numberToString(
+						ScaledInt16{*reinterpret_cast<const std::int16_t*>(data), descriptor.scale}, result);
+					break;
 
 				case DescriptorAdjustedType::INT32:
-					return numericConverter.numberToString(
-						ScaledInt32{*reinterpret_cast<const std::int32_t*>(data), descriptor.scale});
+					numericConverter.numberToString(
+						ScaledInt32{*reinterpret_cast<const std::int32_t*>(data), descriptor.scale}, result);
+					break;
 
 				case DescriptorAdjustedType::INT64:
-					return numericConverter.numberToString(
-						ScaledInt64{*reinterpret_cast<const std::int64_t*>(data), descriptor.scale});
+					numericConverter.numberToString(
+						ScaledInt64{*reinterpret_cast<const std::int64_t*>(data), descriptor.scale}, result);
+					break;
 
 				case DescriptorAdjustedType::INT128:
-					return numericConverter.opaqueInt128ToString(
-						*reinterpret_cast<const OpaqueInt128*>(data), descriptor.scale);
+					numericConverter.opaqueInt128ToString(
+						*reinterpret_cast<const OpaqueInt128*>(data), descriptor.scale, result);
+					break;
 
 				case DescriptorAdjustedType::FLOAT:
-					return numericConverter.numberToString(*reinterpret_cast<const float*>(data));
+					numericConverter.numberToString(*reinterpret_cast<const float*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::DOUBLE:
-					return numericConverter.numberToString(*reinterpret_cast<const double*>(data));
+					numericConverter.numberToString(*reinterpret_cast<const double*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::DATE:
-					return calendarConverter.opaqueDateToString(*reinterpret_cast<const OpaqueDate*>(data));
+					calendarConverter.opaqueDateToString(*reinterpret_cast<const OpaqueDate*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::TIME:
-					return calendarConverter.opaqueTimeToString(*reinterpret_cast<const OpaqueTime*>(data));
+					calendarConverter.opaqueTimeToString(*reinterpret_cast<const OpaqueTime*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::TIMESTAMP:
-					return calendarConverter.opaqueTimestampToString(*reinterpret_cast<const OpaqueTimestamp*>(data));
+					calendarConverter.opaqueTimestampToString(*reinterpret_cast<const OpaqueTimestamp*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::TIME_TZ:
-					return calendarConverter.opaqueTimeTzToString(*reinterpret_cast<const OpaqueTimeTz*>(data));
+					calendarConverter.opaqueTimeTzToString(*reinterpret_cast<const OpaqueTimeTz*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::TIMESTAMP_TZ:
-					return calendarConverter.opaqueTimestampTzToString(
-						*reinterpret_cast<const OpaqueTimestampTz*>(data));
+					calendarConverter.opaqueTimestampTzToString(
+						*reinterpret_cast<const OpaqueTimestampTz*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::DECFLOAT16:
-					return numericConverter.opaqueDecFloat16ToString(*reinterpret_cast<const OpaqueDecFloat16*>(data));
+					numericConverter.opaqueDecFloat16ToString(
+						*reinterpret_cast<const OpaqueDecFloat16*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::DECFLOAT34:
-					return numericConverter.opaqueDecFloat34ToString(*reinterpret_cast<const OpaqueDecFloat34*>(data));
+					numericConverter.opaqueDecFloat34ToString(
+						*reinterpret_cast<const OpaqueDecFloat34*>(data), result);
+					break;
 
 				case DescriptorAdjustedType::STRING:
-					return std::string{reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
-						*reinterpret_cast<const std::uint16_t*>(data)};
+					result.append(reinterpret_cast<const char*>(data + sizeof(std::uint16_t)),
+						*reinterpret_cast<const std::uint16_t*>(data));
+					break;
+
+				case DescriptorAdjustedType::BLOB:
+					if (inlineBlobThreshold == 0)
+						throwInvalidType("std::string", descriptor.adjustedType);
+
+					readBlob(*reinterpret_cast<const ISC_QUAD*>(data), result);
+					break;
 
 				default:
 					throwInvalidType("std::string", descriptor.adjustedType);
 			}
+
+			return true;
+		}
+
+		///
+		/// @brief Reads a binary column: the bytes of a STRING column, or the content of a BLOB column when
+		/// StatementOptions::setInlineBlobThreshold() is set.
+		///
+		std::optional<std::vector<std::byte>> getBytes(unsigned index)
+		{
+			assert(isValid());
+
+			const auto& descriptor = getOutDescriptor(index);
+			const auto* const message = currentOutMessage;
+
+			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
+				return std::nullopt;
+
+			const auto data = &message[descriptor.offset];
+
+			switch (descriptor.adjustedType)
+			{
+				case DescriptorAdjustedType::STRING:
+				{
+					const auto begin = data + sizeof(std::uint16_t);
+					return std::vector<std::byte>(begin, begin + *reinterpret_cast<const std::uint16_t*>(data));
+				}
+
+				case DescriptorAdjustedType::BLOB:
+				{
+					if (inlineBlobThreshold == 0)
+						throwInvalidType("std::vector<std::byte>", descriptor.adjustedType);
+
+					std::vector<std::byte> value;
+					readBlob(*reinterpret_cast<const ISC_QUAD*>(data), value);
+					return value;
+				}
+
+				default:
+					throwInvalidType("std::vector<std::byte>", descriptor.adjustedType);
+			}
 		}
 
 		///
@@ -2591,7 +3071,7 @@ namespace fbcpp
 			assert(isValid());
 
 			const auto& descriptor = getOutDescriptor(index);
-			const auto* const message = outMessage.data();
+			const auto* const message = currentOutMessage;
 
 			if (*reinterpret_cast<const std::int16_t*>(&message[descriptor.nullOffset]) != FB_FALSE)
 				return std::nullopt;
@@ -2633,6 +3113,10 @@ namespace fbcpp
 			return convertNumber<T>(descriptor, data, scale, typeName);
 		}
 
+		// Appends the content of a blob of the current cursor, for BLOB columns read as strings or bytes.
+		void readBlob(const ISC_QUAD& blobId, std::string& result);
+		void readBlob(const ISC_QUAD& blobId, std::vector<std::byte>& result);
+
 		[[noreturn]] static void throwInvalidType(const char* actualType, DescriptorAdjustedType descriptorType)
 		{
 			throw FbCppException(std::format("Invalid type: actual type {}, descriptor type {}",
@@ -2717,6 +3201,17 @@ namespace fbcpp
 		FbRef<fb::IMessageMetadata> outMetadata;
 		std::vector<Descriptor> outDescriptors;
 		std::vector<std::byte> outMessage;
+		FbRef<fb::IBatch> batchHandle;
+		unsigned fetchBufferRows = 0;
+		unsigned inlineBlobThreshold = 0;
+		CursorType cursorType = CursorType::FORWARD_ONLY;
+		std::size_t fetchBufferStride = 0;
+		std::vector<std::byte> fetchBuffer;
+		std::vector<RowView> fetchBufferViews;
+		const std::byte* currentOutMessage = nullptr;
+		bool pendingRow = false;
+		Transaction* cursorTransaction = nullptr;
+		Instrumentation* instrumentation = nullptr;
 		StatementType type;
 	};
 
@@ -2899,6 +3394,12 @@ namespace fbcpp
 		return getString(index);
 	}
 
+	template <>
+	inline std::optional<std::string_view> Statement::get<std::optional<std::string_view>>(unsigned index)
+	{
+		return getStringView(index);
+	}
+
 	///
 	/// @}
 	///
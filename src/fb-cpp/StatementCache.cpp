@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "StatementCache.h"
+#include "Attachment.h"
+#include "Transaction.h"
+#include <iterator>
+#include <utility>
+
+using namespace fbcpp;
+
+
+StatementLease::~StatementLease() noexcept
+{
+	if (cache && statement)
+		cache->release(std::move(sql), options, std::move(statement));
+}
+
+
+StatementCache::StatementCache(Attachment& attachment, std::size_t capacity)
+	: attachment{attachment},
+	  capacity{capacity}
+{
+}
+
+StatementCache::~StatementCache() noexcept
+{
+	clear();
+}
+
+StatementLease StatementCache::acquire(Transaction& transaction, std::string_view sql, const StatementOptions& options)
+{
+	std::string key{sql};
+
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		const auto [first, last] = index.equal_range(key);
+
+		for (auto it = first; it != last; ++it)
+		{
+			const auto entryIt = it->second;
+
+			if (entryIt->options == options)
+			{
+				auto statement = std::move(entryIt->statement);
+				entries.erase(entryIt);
+				index.erase(it);
+
+				++stats.hits;
+				stats.size = entries.size();
+
+				return StatementLease{this, std::move(key), options, std::move(statement)};
+			}
+		}
+
+		++stats.misses;
+	}
+
+	auto statement = std::make_unique<Statement>(attachment, transaction, sql, options);
+
+	return StatementLease{this, std::move(key), options, std::move(statement)};
+}
+
+void StatementCache::clear() noexcept
+{
+	EntryList freed;
+
+	{  // scope
+		std::lock_guard mutexGuard{mutex};
+
+		index.clear();
+		freed.swap(entries);
+		stats.size = 0;
+	}
+
+	// Statements are freed outside the lock; their destructors swallow errors.
+}
+
+StatementCacheStats StatementCache::getStats() const
+{
+	std::lock_guard mutexGuard{mutex};
+	return stats;
+}
+
+void StatementCache::release(
+	std::string&& sql, const StatementOptions& options, std::unique_ptr<Statement> statement) noexcept
+{
+	try
+	{
+		if (!statement->isValid() || capacity == 0u)
+			return;
+
+		statement->closeCursor();
+		statement->cancelBatch();
+		statement->clearParameters();
+	}
+	catch (...)
+	{
+		// A statement that cannot be reset is not reused.
+		return;
+	}
+
+	EntryList evicted;
+
+	try
+	{
+		std::lock_guard mutexGuard{mutex};
+
+		entries.push_front(Entry{std::move(sql), options, std::move(statement)});
+
+		try
+		{
+			index.emplace(entries.front().sql, entries.begin());
+		}
+		catch (...)
+		{
+			entries.pop_front();
+			throw;
+		}
+
+		while (entries.size() > capacity)
+		{
+			const auto last = std::prev(entries.end());
+			const auto [first, end] = index.equal_range(last->sql);
+
+			for (auto it = first; it != end; ++it)
+			{
+				if (it->second == last)
+				{
+					index.erase(it);
+					break;
+				}
+			}
+
+			evicted.splice(evicted.end(), entries, last);
+			++stats.evictions;
+		}
+
+		stats.size = entries.size();
+	}
+	catch (...)
+	{
+		// Out of memory while caching: the statement is freed.
+	}
+}
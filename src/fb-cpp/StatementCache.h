@@ -0,0 +1,228 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef FBCPP_STATEMENT_CACHE_H
+#define FBCPP_STATEMENT_CACHE_H
+
+#include "fb-cpp_api.h"
+#include "Statement.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+
+
+///
+/// fb-cpp namespace.
+///
+namespace fbcpp
+{
+	class Attachment;
+	class Transaction;
+	class StatementCache;
+
+	///
+	/// @brief Counters reported by a StatementCache.
+	///
+	struct StatementCacheStats final
+	{
+		///
+		/// Number of acquisitions served by an already prepared statement.
+		///
+		std::uint64_t hits = 0;
+
+		///
+		/// Number of acquisitions that had to prepare a new statement.
+		///
+		std::uint64_t misses = 0;
+
+		///
+		/// Number of idle statements freed to keep the cache within its capacity.
+		///
+		std::uint64_t evictions = 0;
+
+		///
+		/// Number of idle statements currently held by the cache.
+		///
+		std::size_t size = 0;
+	};
+
+	///
+	/// @brief Exclusive use of a cached prepared statement; returns it to the cache when destroyed.
+	///
+	class FBCPP_API StatementLease final
+	{
+		friend class StatementCache;
+
+	public:
+		///
+		/// @brief Transfers the lease; the moved-from lease becomes empty.
+		///
+		StatementLease(StatementLease&& o) noexcept
+			: cache{o.cache},
+			  sql{std::move(o.sql)},
+			  options{o.options},
+			  statement{std::move(o.statement)}
+		{
+			o.cache = nullptr;
+		}
+
+		StatementLease& operator=(StatementLease&&) = delete;
+		StatementLease(const StatementLease&) = delete;
+		StatementLease& operator=(const StatementLease&) = delete;
+
+		///
+		/// @brief Returns the statement to the cache.
+		///
+		~StatementLease() noexcept;
+
+	public:
+		///
+		/// @brief Returns the leased statement.
+		///
+		Statement& get() noexcept
+		{
+			return *statement;
+		}
+
+		///
+		/// @brief Returns the leased statement.
+		///
+		Statement& operator*() noexcept
+		{
+			return *statement;
+		}
+
+		///
+		/// @brief Accesses members of the leased statement.
+		///
+		Statement* operator->() noexcept
+		{
+			return statement.get();
+		}
+
+	private:
+		explicit StatementLease(StatementCache* cache, std::string sql, const StatementOptions& options,
+			std::unique_ptr<Statement> statement) noexcept
+			: cache{cache},
+			  sql{std::move(sql)},
+			  options{options},
+			  statement{std::move(statement)}
+		{
+		}
+
+	private:
+		StatementCache* cache;
+		std::string sql;
+		StatementOptions options;
+		std::unique_ptr<Statement> statement;
+	};
+
+	///
+	/// @brief Least-recently-used cache of prepared statements of an Attachment, keyed by SQL text and
+	/// StatementOptions.
+	///
+	/// Statements are handed out as StatementLease objects and, when the lease ends, are reset (cursor
+	/// closed, pending batch canceled, parameters set to null) and kept for reuse. The cache holds at most
+	/// `capacity` idle statements; the least recently used ones are freed beyond that. The same SQL may be
+	/// leased several times at once, in which case each lease gets its own prepared statement.
+	///
+	/// The cache is thread-safe, but it must outlive its leases and the attachment must outlive the cache.
+	///
+	class FBCPP_API StatementCache final
+	{
+		friend class StatementLease;
+
+	public:
+		///
+		/// @brief Creates an empty cache for statements of the given attachment.
+		/// @param attachment Attachment used to prepare statements.
+		/// @param capacity Maximum number of idle statements kept.
+		///
+		explicit StatementCache(Attachment& attachment, std::size_t capacity = 64);
+
+		StatementCache(const StatementCache&) = delete;
+		StatementCache& operator=(const StatementCache&) = delete;
+
+		///
+		/// @brief Frees all idle statements.
+		///
+		~StatementCache() noexcept;
+
+	public:
+		///
+		/// @brief Leases a prepared statement for the given SQL and options, preparing it if needed.
+		/// @param transaction Transaction used to prepare the statement on a cache miss.
+		/// @param sql Statement text.
+		/// @param options Prepare options; part of the cache key.
+		///
+		StatementLease acquire(Transaction& transaction, std::string_view sql, const StatementOptions& options = {});
+
+		///
+		/// @brief Frees all idle statements.
+		///
+		void clear() noexcept;
+
+		///
+		/// @brief Returns the maximum number of idle statements kept.
+		///
+		std::size_t getCapacity() const noexcept
+		{
+			return capacity;
+		}
+
+		///
+		/// @brief Returns a snapshot of the cache counters.
+		///
+		StatementCacheStats getStats() const;
+
+	private:
+		struct Entry final
+		{
+			std::string sql;
+			StatementOptions options;
+			std::unique_ptr<Statement> statement;
+		};
+
+		using EntryList = std::list<Entry>;
+
+		void release(std::string&& sql, const StatementOptions& options, std::unique_ptr<Statement> statement) noexcept;
+
+	private:
+		Attachment& attachment;
+		const std::size_t capacity;
+		mutable std::mutex mutex;
+		EntryList entries;  // Most recently used first.
+		std::unordered_multimap<std::string, EntryList::iterator> index;
+		StatementCacheStats stats;
+	};
+}  // namespace fbcpp
+
+
+#endif  // FBCPP_STATEMENT_CACHE_H
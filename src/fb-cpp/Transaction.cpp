@@ -26,7 +26,10 @@
 #include "Attachment.h"
 #include "Client.h"
 #include "Exception.h"
+#include "Instrumentation.h"
+#include "firebird/impl/inf_pub.h"
 #include <cassert>
+#include <cstdint>
 
 using namespace fbcpp;
 using namespace fbcpp::impl;
@@ -128,44 +131,87 @@ static FbUniquePtr<fb::IXpbBuilder> buildTpb(
 	if (options.getAutoCommit())
 		tpbBuilder->insertTag(&statusWrapper, isc_tpb_autocommit);
 
+	if (const auto atSnapshotNumber = options.getAtSnapshotNumber())
+	{
+		tpbBuilder->insertBigInt(
+			&statusWrapper, isc_tpb_at_snapshot_number, static_cast<ISC_INT64>(atSnapshotNumber.value()));
+	}
+
 	return tpbBuilder;
 }
 
 
+CompiledTransactionOptions::CompiledTransactionOptions(Client& client, const TransactionOptions& options)
+{
+	const auto status = client.newStatus();
+	StatusWrapper statusWrapper{client, status.get()};
+
+	auto tpbBuilder = buildTpb(client.getMaster(), statusWrapper, options);
+	const auto tpbBuffer = tpbBuilder->getBuffer(&statusWrapper);
+	tpb.assign(tpbBuffer, tpbBuffer + tpbBuilder->getBufferLength(&statusWrapper));
+}
+
+
 Transaction::Transaction(Attachment& attachment, const TransactionOptions& options)
 	: client{attachment.getClient()},
-	  uri_{attachment.getUri()}
+	  uri_{attachment.getUri()},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()},
+	  instrumentation{attachment.getInstrumentation()}
 {
 	assert(attachment.isValid());
 
-	const auto master = client.getMaster();
+	InstrumentationTimer timer{instrumentation};
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
+	const auto master = client.getMaster();
 
 	auto tpbBuilder = buildTpb(master, statusWrapper, options);
 	const auto tpbBuffer = tpbBuilder->getBuffer(&statusWrapper);
 	const auto tpbBufferLen = tpbBuilder->getBufferLength(&statusWrapper);
 
 	handle.reset(attachment.getHandle()->startTransaction(&statusWrapper, tpbBufferLen, tpbBuffer));
+	timer.reportTransaction(TransactionOperation::START);
+}
+
+Transaction::Transaction(Attachment& attachment, const CompiledTransactionOptions& options)
+	: client{attachment.getClient()},
+	  uri_{attachment.getUri()},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()},
+	  instrumentation{attachment.getInstrumentation()}
+{
+	assert(attachment.isValid());
+
+	InstrumentationTimer timer{instrumentation};
+
+	const auto& tpb = options.getTpb();
+	handle.reset(
+		attachment.getHandle()->startTransaction(&statusWrapper, static_cast<unsigned>(tpb.size()), tpb.data()));
+	timer.reportTransaction(TransactionOperation::START);
 }
 
 Transaction::Transaction(Attachment& attachment, std::string_view setTransactionCmd)
 	: client{attachment.getClient()},
-	  uri_{attachment.getUri()}
+	  uri_{attachment.getUri()},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()},
+	  instrumentation{attachment.getInstrumentation()}
 {
 	assert(attachment.isValid());
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
+	InstrumentationTimer timer{instrumentation};
 
 	handle.reset(
 		attachment.getHandle()->execute(&statusWrapper, nullptr, static_cast<unsigned>(setTransactionCmd.length()),
 			setTransactionCmd.data(), SQL_DIALECT_V6, nullptr, nullptr, nullptr, nullptr));
+	timer.reportTransaction(TransactionOperation::START);
 }
 
 Transaction::Transaction(std::span<std::reference_wrapper<Attachment>> attachments, const TransactionOptions& options)
 	: client{attachments[0].get().getClient()},
+	  status{client.newStatus()},
+	  statusWrapper{client, status.get()},
+	  instrumentation{attachments[0].get().getInstrumentation()},
 	  isMultiDatabase{true}
 {
 	assert(!attachments.empty());
@@ -179,10 +225,9 @@ Transaction::Transaction(std::span<std::reference_wrapper<Attachment>> attachmen
 			throw std::invalid_argument("All attachments must use the same Client for multi-database transactions");
 	}
 
-	const auto master = client.getMaster();
+	InstrumentationTimer timer{instrumentation};
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
+	const auto master = client.getMaster();
 
 	auto tpbBuilder = buildTpb(master, statusWrapper, options);
 	const auto tpbBuffer = tpbBuilder->getBuffer(&statusWrapper);
@@ -198,6 +243,8 @@ Transaction::Transaction(std::span<std::reference_wrapper<Attachment>> attachmen
 	// Start the multi-database transaction, which disposes the IDtcStart instance
 	handle.reset(dtcStart->start(&statusWrapper));
 	dtcStart.release();
+
+	timer.reportTransaction(TransactionOperation::START);
 }
 
 void Transaction::rollback()
@@ -205,10 +252,9 @@ void Transaction::rollback()
 	assert(isValid());
 	assert(state == TransactionState::ACTIVE || state == TransactionState::PREPARED);
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
-
+	InstrumentationTimer timer{instrumentation};
 	handle->rollback(&statusWrapper);
+	timer.reportTransaction(TransactionOperation::ROLLBACK);
 	handle.reset();
 	state = TransactionState::ROLLED_BACK;
 }
@@ -218,10 +264,9 @@ void Transaction::commit()
 	assert(isValid());
 	assert(state == TransactionState::ACTIVE || state == TransactionState::PREPARED);
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
-
+	InstrumentationTimer timer{instrumentation};
 	handle->commit(&statusWrapper);
+	timer.reportTransaction(TransactionOperation::COMMIT);
 	handle.reset();
 	state = TransactionState::COMMITTED;
 }
@@ -231,10 +276,9 @@ void Transaction::commitRetaining()
 	assert(isValid());
 	assert(state == TransactionState::ACTIVE);
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
-
+	InstrumentationTimer timer{instrumentation};
 	handle->commitRetaining(&statusWrapper);
+	timer.reportTransaction(TransactionOperation::COMMIT_RETAINING);
 }
 
 void Transaction::rollbackRetaining()
@@ -242,10 +286,9 @@ void Transaction::rollbackRetaining()
 	assert(isValid());
 	assert(state == TransactionState::ACTIVE);
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
-
+	InstrumentationTimer timer{instrumentation};
 	handle->rollbackRetaining(&statusWrapper);
+	timer.reportTransaction(TransactionOperation::ROLLBACK_RETAINING);
 }
 
 void Transaction::prepare()
@@ -258,10 +301,9 @@ void Transaction::prepare(std::span<const std::uint8_t> message)
 	assert(isValid());
 	assert(state == TransactionState::ACTIVE);
 
-	const auto status = client.newStatus();
-	StatusWrapper statusWrapper{client, status.get()};
-
+	InstrumentationTimer timer{instrumentation};
 	handle->prepare(&statusWrapper, static_cast<unsigned>(message.size()), message.data());
+	timer.reportTransaction(TransactionOperation::PREPARE);
 	state = TransactionState::PREPARED;
 }
 
@@ -270,3 +312,50 @@ void Transaction::prepare(std::string_view message)
 	const auto messageBytes = reinterpret_cast<const std::uint8_t*>(message.data());
 	prepare(std::span<const std::uint8_t>{messageBytes, message.size()});
 }
+
+std::uint64_t Transaction::getSnapshotNumber()
+{
+	assert(isValid());
+
+	const std::uint8_t items[] = {isc_info_tra_snapshot_number};
+	std::uint8_t buffer[32]{};
+
+	handle->getInfo(&statusWrapper, sizeof(items), items, sizeof(buffer), buffer);
+
+	const auto* ptr = buffer;
+	const auto* end = buffer + sizeof(buffer);
+
+	while (ptr < end)
+	{
+		const auto item = *ptr++;
+
+		if (item == isc_info_end)
+			break;
+
+		if (item == isc_info_truncated || item == isc_info_error)
+			throw FbCppException("Transaction::getSnapshotNumber not supported by the server");
+
+		if (ptr + 2 > end)
+			throw FbCppException("Transaction::getSnapshotNumber malformed response");
+
+		const auto itemLength = static_cast<std::uint16_t>((ptr[0]) | (ptr[1] << 8));
+		ptr += 2;
+
+		if (ptr + itemLength > end)
+			throw FbCppException("Transaction::getSnapshotNumber invalid length");
+
+		if (item == isc_info_tra_snapshot_number)
+		{
+			std::uint64_t result = 0;
+
+			for (std::uint16_t i = 0; i < itemLength; ++i)
+				result |= static_cast<std::uint64_t>(ptr[i]) << (8u * i);
+
+			return result;
+		}
+
+		ptr += itemLength;
+	}
+
+	throw FbCppException("Transaction::getSnapshotNumber value not found");
+}
@@ -29,6 +29,7 @@
 #include "fb-api.h"
 #if !FB_CPP_LEGACY_API
 #include "SmartPtrs.h"
+#include "Exception.h"
 #endif
 #include <memory>
 #include <optional>
@@ -39,6 +40,7 @@
 #include <string_view>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
 
 
 ///
@@ -47,6 +49,7 @@
 namespace fbcpp
 {
 	class Attachment;
+	class Instrumentation;
 
 	///
 	/// Transaction isolation level.
@@ -290,6 +293,25 @@ namespace fbcpp
 			return *this;
 		}
 
+		///
+		/// Returns the snapshot number the transaction will share, if any.
+		///
+		const std::optional<std::uint64_t> getAtSnapshotNumber() const
+		{
+			return atSnapshotNumber;
+		}
+
+		///
+		/// Sets the snapshot number, as returned by Transaction::getSnapshotNumber(), of an active snapshot
+		/// the transaction will share, so it sees exactly the same data (Firebird 4.0+).
+		/// Only valid with the SNAPSHOT isolation level.
+		///
+		TransactionOptions& setAtSnapshotNumber(std::uint64_t value)
+		{
+			atSnapshotNumber = value;
+			return *this;
+		}
+
 	private:
 		std::vector<std::uint8_t> tpb;
 		std::optional<TransactionIsolationLevel> isolationLevel;
@@ -300,10 +322,38 @@ namespace fbcpp
 		bool ignoreLimbo = false;
 		bool restartRequests = false;
 		bool autoCommit = false;
+		std::optional<std::uint64_t> atSnapshotNumber;
 	};
 
 	class Client;
 
+#if !FB_CPP_LEGACY_API
+	///
+	/// TransactionOptions serialized once into a TPB (Transaction Parameter Block), for starting many
+	/// transactions with the same options without rebuilding the block each time.
+	///
+	class FBCPP_API CompiledTransactionOptions final
+	{
+	public:
+		///
+		/// Serializes `options` using the specified Client.
+		///
+		explicit CompiledTransactionOptions(Client& client, const TransactionOptions& options = {});
+
+	public:
+		///
+		/// Returns the serialized TPB.
+		///
+		const std::vector<std::uint8_t>& getTpb() const noexcept
+		{
+			return tpb;
+		}
+
+	private:
+		std::vector<std::uint8_t> tpb;
+	};
+#endif
+
 	///
 	/// Transaction state for tracking two-phase commit lifecycle.
 	///
@@ -351,6 +401,8 @@ namespace fbcpp
 	/// being committed or rolled back (and not prepared), it will be automatically
 	/// rolled back.
 	///
+	/// Like Statement, it reuses one status object for its calls, so its methods must not run concurrently.
+	///
 	class FBCPP_API Transaction final
 	{
 	public:
@@ -360,6 +412,14 @@ namespace fbcpp
 		///
 		explicit Transaction(Attachment& attachment, const TransactionOptions& options = {});
 
+#if !FB_CPP_LEGACY_API
+		///
+		/// Constructs a Transaction object that starts a transaction in the specified
+		/// Attachment using a TPB serialized in advance.
+		///
+		explicit Transaction(Attachment& attachment, const CompiledTransactionOptions& options);
+#endif
+
 		///
 		/// Constructs a Transaction object that starts a transaction specified by a
 		/// `SET TRANSACTION` command.
@@ -388,7 +448,10 @@ namespace fbcpp
 #if FB_CPP_LEGACY_API
 			  handle{o.handle},
 #else
+			  status{std::move(o.status)},
+			  statusWrapper{std::move(o.statusWrapper)},
 			  handle{std::move(o.handle)},
+			  instrumentation{o.instrumentation},
 #endif
 			  state{o.state},
 			  isMultiDatabase{o.isMultiDatabase}
@@ -523,13 +586,24 @@ namespace fbcpp
 		///
 		void rollbackRetaining();
 
+#if !FB_CPP_LEGACY_API
+		///
+		/// Returns the number of the snapshot used by a SNAPSHOT transaction (Firebird 4.0+), which other
+		/// transactions can share with TransactionOptions::setAtSnapshotNumber().
+		///
+		std::uint64_t getSnapshotNumber();
+#endif
+
 	private:
 		Client& client;
 		std::string uri_;  // Database URI for error messages
 #if FB_CPP_LEGACY_API
 		isc_tr_handle handle = 0;
 #else
+		FbUniquePtr<fb::IStatus> status;
+		impl::StatusWrapper statusWrapper;
 		FbRef<fb::ITransaction> handle;
+		Instrumentation* instrumentation;
 #endif
 		TransactionState state = TransactionState::ACTIVE;
 		const bool isMultiDatabase = false;
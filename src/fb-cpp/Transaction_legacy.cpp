@@ -105,6 +105,9 @@ static TPB buildTpb(const TransactionOptions& options)
 	if (options.getAutoCommit())
 		tpb.addTag(isc_tpb_autocommit);
 
+	if (options.getAtSnapshotNumber())
+		throw Exception("Snapshot sharing requires Firebird 4.0 or later");
+
 	return tpb;
 }
 
@@ -37,4 +37,8 @@
 #endif
 #endif
 
+#if !defined(FB_CPP_USE_INSTRUMENTATION)
+#define FB_CPP_USE_INSTRUMENTATION 1
+#endif
+
 #endif  // FBCPP_CONFIG_H
@@ -41,6 +41,19 @@
 #include "Statement.h"
 #include "Blob.h"
 #include "EventListener.h"
+#include "ColumnarResult.h"
+#include "ArrowExporter.h"
+#include "StatementCache.h"
+#include "ConnectionPool.h"
+#include "AsyncExecutor.h"
+#include "RowBinder.h"
+#include "RowRange.h"
+#include "BlobStream.h"
+#include "BufferPool.h"
+#include "ParallelQuery.h"
+#include "ResultPager.h"
+#include "Instrumentation.h"
+#include "ServiceManager.h"
 #endif
 
 #endif  // FBCPP_H
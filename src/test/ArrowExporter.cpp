@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ArrowExporter.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <string>
+#include <string_view>
+
+
+BOOST_AUTO_TEST_SUITE(ArrowExporterSuite)
+
+BOOST_AUTO_TEST_CASE(exportSchemaMapsTypes)
+{
+	const auto database = getTempFile("ArrowExporter-exportSchemaMapsTypes.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select cast(1 as integer) i, cast(1.5 as numeric(10, 2)) n, date '2024-01-02' d, "
+		"timestamp '2024-01-02 03:04:05' ts, cast('x' as varchar(5)) v, true b from rdb$database"};
+
+	ArrowExporter exporter{select};
+
+	ArrowSchema schema;
+	exporter.exportSchema(&schema);
+
+	BOOST_CHECK_EQUAL(std::string_view{schema.format}, "+s");
+	BOOST_REQUIRE_EQUAL(schema.n_children, 6);
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[0]->format}, "i");
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[0]->name}, "I");
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[1]->format}, "d:19,2");
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[2]->format}, "tdD");
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[3]->format}, "tsu:");
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[4]->format}, "u");
+	BOOST_CHECK_EQUAL(std::string_view{schema.children[5]->format}, "b");
+
+	schema.release(&schema);
+	BOOST_CHECK(schema.release == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(exportNextBatchMovesColumns)
+{
+	const auto database = getTempFile("ArrowExporter-exportNextBatchMovesColumns.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction,
+		"create table t (id integer, price numeric(10, 2), day date, name varchar(10), flag boolean)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t values (?, ?, ?, ?, ?)"};
+	for (int i = 0; i < 5; ++i)
+	{
+		insert.setInt32(0, i);
+		insert.setScaledInt64(1, ScaledInt64{i * 100 + 25, -2});
+		insert.setDate(2, Date{std::chrono::year{1970}, std::chrono::January, std::chrono::day{unsigned(i + 1)}});
+		insert.setString(3, i == 2 ? std::nullopt : std::optional<std::string>{"r" + std::to_string(i)});
+		insert.setBool(4, i % 2 == 0);
+		insert.execute(transaction);
+	}
+
+	Statement select{attachment, transaction, "select id, price, day, name, flag from t order by id",
+		StatementOptions().setFetchBufferRows(2)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	ArrowExporter exporter{select, 3};
+
+	ArrowArray batch;
+	BOOST_REQUIRE(exporter.exportNextBatch(&batch));
+	BOOST_CHECK_EQUAL(batch.length, 3);
+	BOOST_REQUIRE_EQUAL(batch.n_children, 5);
+
+	const auto ids = static_cast<const std::int32_t*>(batch.children[0]->buffers[1]);
+	BOOST_CHECK_EQUAL(ids[2], 2);
+
+	const auto prices = static_cast<const std::int64_t*>(batch.children[1]->buffers[1]);
+	BOOST_CHECK_EQUAL(prices[2], 225);  // low word of the decimal128 value
+	BOOST_CHECK_EQUAL(prices[3], 0);  // high word
+
+	const auto days = static_cast<const std::int32_t*>(batch.children[2]->buffers[1]);
+	BOOST_CHECK_EQUAL(days[0], 0);
+	BOOST_CHECK_EQUAL(days[2], 2);
+
+	const auto names = batch.children[3];
+	BOOST_CHECK_EQUAL(names->null_count, 1);
+	const auto validity = static_cast<const std::uint8_t*>(names->buffers[0]);
+	BOOST_CHECK_EQUAL(validity[0], 0b011);
+	const auto offsets = static_cast<const std::int32_t*>(names->buffers[1]);
+	const auto chars = static_cast<const char*>(names->buffers[2]);
+	BOOST_CHECK_EQUAL((std::string_view{chars + offsets[1], std::size_t(offsets[2] - offsets[1])}), "r1");
+	BOOST_CHECK_EQUAL(offsets[3] - offsets[2], 0);
+
+	const auto flags = static_cast<const std::uint8_t*>(batch.children[4]->buffers[1]);
+	BOOST_CHECK_EQUAL(flags[0], 0b101);
+
+	batch.release(&batch);
+	BOOST_CHECK(batch.release == nullptr);
+
+	BOOST_REQUIRE(exporter.exportNextBatch(&batch));
+	BOOST_CHECK_EQUAL(batch.length, 2);
+	batch.release(&batch);
+
+	BOOST_CHECK(!exporter.exportNextBatch(&batch));
+}
+
+BOOST_AUTO_TEST_CASE(exportRejectsUnsupportedTypes)
+{
+	const auto database = getTempFile("ArrowExporter-exportRejectsUnsupportedTypes.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction, "select cast('x' as blob) from rdb$database"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	ArrowExporter exporter{select};
+
+	ArrowSchema schema;
+	BOOST_CHECK_THROW(exporter.exportSchema(&schema), FbCppException);
+
+	ArrowArray batch;
+	BOOST_CHECK_THROW(exporter.exportNextBatch(&batch), FbCppException);
+	BOOST_CHECK_THROW((ArrowExporter{select, 0}), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(exportChecksInt128Range)
+{
+	const auto database = getTempFile("ArrowExporter-exportChecksInt128Range.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	{  // scope
+		Statement select{attachment, transaction,
+			"select cast('-99999999999999999999999999999999999999' as int128) from rdb$database"};
+		BOOST_REQUIRE(select.execute(transaction));
+
+		ArrowExporter exporter{select};
+
+		ArrowArray batch;
+		BOOST_REQUIRE(exporter.exportNextBatch(&batch));
+		BOOST_CHECK_EQUAL(batch.length, 1);
+		batch.release(&batch);
+	}
+
+	{  // scope
+		Statement select{attachment, transaction,
+			"select cast('100000000000000000000000000000000000000' as int128) from rdb$database"};
+		BOOST_REQUIRE(select.execute(transaction));
+
+		ArrowExporter exporter{select};
+
+		ArrowArray batch;
+		BOOST_CHECK_THROW(exporter.exportNextBatch(&batch), FbCppException);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,206 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/AsyncExecutor.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+	// Minimal eagerly started coroutine type used to drive co_await in the tests.
+	struct TestTask final
+	{
+		struct promise_type final
+		{
+			TestTask get_return_object()
+			{
+				return TestTask{future = promise.get_future()};
+			}
+
+			std::suspend_never initial_suspend() noexcept
+			{
+				return {};
+			}
+
+			std::suspend_never final_suspend() noexcept
+			{
+				return {};
+			}
+
+			void return_void()
+			{
+				promise.set_value();
+			}
+
+			void unhandled_exception()
+			{
+				promise.set_exception(std::current_exception());
+			}
+
+			std::promise<void> promise;
+			std::shared_future<void> future;
+		};
+
+		explicit TestTask(std::shared_future<void> future)
+			: future{std::move(future)}
+		{
+		}
+
+		void wait()
+		{
+			future.get();
+		}
+
+		std::shared_future<void> future;
+	};
+}  // namespace
+
+
+BOOST_AUTO_TEST_SUITE(AsyncExecutorSuite)
+
+BOOST_AUTO_TEST_CASE(submitRunsOnWorkerThread)
+{
+	AsyncExecutor executor;
+
+	const auto workerId = executor.submit([] { return std::this_thread::get_id(); }).get();
+	BOOST_CHECK(workerId != std::this_thread::get_id());
+
+	BOOST_CHECK_EQUAL(executor.submit([] { return 42; }).get(), 42);
+	BOOST_CHECK_THROW(executor.submit([] { throw std::runtime_error{"error"}; }).get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(operationsRunInSubmissionOrder)
+{
+	AsyncExecutor executor{4};
+
+	std::vector<int> order;
+	std::vector<AsyncOperation<void>> operations;
+
+	for (int i = 0; i < 100; ++i)
+		operations.push_back(executor.submit([&order, i] { order.push_back(i); }));
+
+	for (auto& operation : operations)
+		operation.get();
+
+	BOOST_REQUIRE_EQUAL(order.size(), 100u);
+
+	for (int i = 0; i < 100; ++i)
+		BOOST_CHECK_EQUAL(order[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(coroutineAwaitsStatementExecution)
+{
+	const auto database = getTempFile("AsyncExecutor-coroutineAwaitsStatementExecution.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	AsyncExecutor executor;
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select 1 from rdb$database union all select 2 from rdb$database union all select 3 from rdb$database"};
+
+	int sum = 0;
+
+	const auto run = [&]() -> TestTask
+	{
+		if (co_await executor.execute(select, transaction))
+		{
+			do
+				sum += select.getInt32(0).value();
+			while (co_await executor.fetchNext(select));
+		}
+
+		co_await executor.commit(transaction);
+	};
+
+	run().wait();
+
+	BOOST_CHECK_EQUAL(sum, 6);
+	BOOST_CHECK(!transaction.isValid());
+}
+
+BOOST_AUTO_TEST_CASE(coroutineReceivesExceptions)
+{
+	AsyncExecutor executor;
+	std::atomic_bool caught = false;
+
+	const auto run = [&]() -> TestTask
+	{
+		try
+		{
+			co_await executor.submit([] { throw FbCppException{"failure"}; });
+		}
+		catch (const FbCppException&)
+		{
+			caught = true;
+		}
+	};
+
+	run().wait();
+	BOOST_CHECK(caught);
+}
+
+BOOST_AUTO_TEST_CASE(resumerControlsWhereCoroutinesResume)
+{
+	std::atomic_int resumed = 0;
+
+	AsyncExecutor executor{16,
+		[&resumed](std::coroutine_handle<> handle)
+		{
+			++resumed;
+			handle.resume();
+		}};
+
+	// Holds the first operation until the coroutine is suspended on it.
+	std::promise<void> gate;
+	auto gateFuture = gate.get_future();
+
+	const auto run = [&]() -> TestTask
+	{
+		co_await executor.submit([&gateFuture] { gateFuture.wait(); });
+		// Resumed on the worker thread, so this operation cannot complete before being awaited.
+		co_await executor.submit([] {});
+	};
+
+	auto task = run();
+	gate.set_value();
+	task.wait();
+
+	BOOST_CHECK_EQUAL(resumed.load(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,6 +25,10 @@
 #include "TestUtil.h"
 #include "fb-cpp/Attachment.h"
 #include "fb-cpp/Exception.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <algorithm>
+#include <chrono>
 #include <exception>
 
 
@@ -40,6 +44,29 @@ BOOST_AUTO_TEST_CASE(constructor)
 	attachment2.dropDatabase();
 }
 
+BOOST_AUTO_TEST_CASE(constructorWithCompiledOptions)
+{
+	const auto database = getTempFile("Attachment-constructorWithCompiledOptions.fdb");
+	const CompiledAttachmentOptions createOptions{
+		CLIENT, AttachmentOptions().setCreateDatabase(true).setConnectionCharSet("UTF8")};
+	BOOST_CHECK(createOptions.getCreateDatabase());
+	BOOST_CHECK(!createOptions.getDpb().empty());
+
+	Attachment attachment1{CLIENT, database, createOptions};
+	attachment1.disconnect();
+
+	const CompiledAttachmentOptions connectOptions{CLIENT, AttachmentOptions().setConnectionCharSet("UTF8")};
+
+	for (int i = 0; i < 3; ++i)
+	{
+		Attachment attachment{CLIENT, database, connectOptions};
+		BOOST_CHECK(attachment.isValid());
+	}
+
+	Attachment attachment2{CLIENT, database, connectOptions};
+	attachment2.dropDatabase();
+}
+
 BOOST_AUTO_TEST_CASE(disconnect)
 {
 	const auto database = getTempFile("Attachment-disconnect.fdb");
@@ -59,6 +86,15 @@ BOOST_AUTO_TEST_CASE(dropDatabase)
 	BOOST_CHECK_THROW(Attachment(CLIENT, database), DatabaseException);
 }
 
+BOOST_AUTO_TEST_CASE(ping)
+{
+	const auto database = getTempFile("Attachment-ping.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	BOOST_CHECK_NO_THROW(attachment.ping());
+}
+
 BOOST_AUTO_TEST_CASE(isNotValidAfterMove)
 {
 	const auto database = getTempFile("Attachment-isNotValidAfterMove.fdb");
@@ -94,4 +130,74 @@ BOOST_AUTO_TEST_CASE(isNotValidAfterDropDatabase)
 	BOOST_CHECK_EQUAL(attachment1.isValid(), false);
 }
 
+BOOST_AUTO_TEST_CASE(getPerformanceCounters)
+{
+	const auto database = getTempFile("Attachment-getPerformanceCounters.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement relation{
+		attachment, transaction, "select rdb$relation_id from rdb$relations where rdb$relation_name = 'T'"};
+	BOOST_REQUIRE(relation.execute(transaction));
+	const auto relationId = static_cast<unsigned>(relation.getInt32(0).value());
+
+	Statement insert{attachment, transaction, "insert into t (id) values (1)"};
+
+	const auto before = attachment.getPerformanceCounters();
+
+	insert.execute(transaction);
+	insert.execute(transaction);
+
+	const auto after = attachment.getPerformanceCounters();
+	BOOST_CHECK(after.fetches > before.fetches);
+
+	const auto delta = after.since(before);
+	const auto table = std::find_if(delta.tables.begin(), delta.tables.end(),
+		[&](const TableRecordCounts& counts) { return counts.relationId == relationId; });
+
+	BOOST_REQUIRE(table != delta.tables.end());
+	BOOST_CHECK_EQUAL(table->inserts, 2u);
+	BOOST_CHECK_EQUAL(table->deletes, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(constructorWithTuningOptions)
+{
+	const auto database = getTempFile("Attachment-constructorWithTuningOptions.fdb");
+
+	Attachment attachment{CLIENT, database,
+		AttachmentOptions()
+			.setCreateDatabase(true)
+			.setWireCompression(true)
+			.setPageBuffers(2048)
+			.setStatementTimeout(std::chrono::milliseconds{30000})};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	Statement select{attachment, transaction,
+		"select mon$statement_timeout from mon$attachments where mon$attachment_id = current_connection"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 30000);
+}
+
+BOOST_AUTO_TEST_CASE(constructorRejectsOutOfRangeTuningOptions)
+{
+	const auto database = getTempFile("Attachment-constructorRejectsOutOfRangeTuningOptions.fdb");
+
+	const auto attach = [&](const AttachmentOptions& options) { Attachment attachment{CLIENT, database, options}; };
+	const auto options = AttachmentOptions().setCreateDatabase(true);
+
+	BOOST_CHECK_THROW(
+		attach(AttachmentOptions{options}.setStatementTimeout(std::chrono::milliseconds{-1})), FbCppException);
+	BOOST_CHECK_THROW(
+		attach(AttachmentOptions{options}.setStatementTimeout(std::chrono::hours{24 * 30})), FbCppException);
+	BOOST_CHECK_THROW(attach(AttachmentOptions{options}.setPageBuffers(0x80000000u)), FbCppException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,14 +25,25 @@
 #include "TestUtil.h"
 #include "fb-cpp/Attachment.h"
 #include "fb-cpp/Blob.h"
+#include "fb-cpp/BufferPool.h"
 #include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
 #include <array>
+#include <cstdio>
 #include <limits>
+#include <memory>
 #include <span>
 #include <string>
 #include <vector>
 
+#ifdef _WIN32
+#include <io.h>
+#define fileno _fileno
+#define lseek _lseek
+#else
+#include <unistd.h>
+#endif
+
 
 BOOST_AUTO_TEST_SUITE(BlobSuite)
 
@@ -209,6 +220,74 @@ BOOST_AUTO_TEST_CASE(createWriteRead)
 	}
 }
 
+BOOST_AUTO_TEST_CASE(copyToAndFromFileDescriptor)
+{
+	const auto database = getTempFile("Blob-copyToAndFromFileDescriptor.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	BufferPool pool{100000};
+
+	// A partial last chunk, and an exact multiple of the buffer size whose end is only seen by an empty read.
+	for (const std::size_t size : {std::size_t{250000}, std::size_t{300000}})
+	{
+		BOOST_TEST_CONTEXT("size " << size)
+		{
+			std::string text(size, '\0');
+
+			for (std::size_t i = 0; i < text.size(); ++i)
+				text[i] = static_cast<char>('a' + (i % 26));
+
+			Blob source{attachment, transaction};
+			source.write(std::span{text});
+			source.close();
+
+			std::unique_ptr<std::FILE, decltype(&std::fclose)> file{std::tmpfile(), &std::fclose};
+			BOOST_REQUIRE(file);
+			const auto fd = fileno(file.get());
+
+			std::vector<std::uint64_t> progress;
+			std::uint64_t progressTotal = 0;
+
+			{  // scope
+				Blob reader{attachment, transaction, source.getId()};
+				const auto copied = reader.copyTo(fd,
+					BlobCopyOptions().setBufferPool(&pool).setProgress(
+						[&](std::uint64_t copied, std::uint64_t total)
+						{
+							progress.push_back(copied);
+							progressTotal = total;
+						}));
+
+				BOOST_CHECK_EQUAL(copied, text.size());
+				BOOST_CHECK_EQUAL(progressTotal, text.size());
+				BOOST_REQUIRE_EQUAL(progress.size(), 3U);
+				BOOST_CHECK_EQUAL(progress[0], 100000U);
+				BOOST_CHECK_EQUAL(progress[1], 200000U);
+				BOOST_CHECK_EQUAL(progress[2], text.size());
+
+				// No call for the empty read that ends the copy.
+				for (std::size_t i = 1; i < progress.size(); ++i)
+					BOOST_CHECK_GT(progress[i], progress[i - 1]);
+			}
+
+			BOOST_REQUIRE_EQUAL(lseek(fd, 0, SEEK_SET), 0);
+
+			Blob target{attachment, transaction};
+			BOOST_CHECK_EQUAL(target.copyFrom(fd, BlobCopyOptions().setBufferPool(&pool)), text.size());
+			target.close();
+
+			Blob reader{attachment, transaction, target.getId()};
+			std::string result;
+			reader.readAll(result);
+			BOOST_CHECK(result == text);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_CASE(cancelDiscardsHandle)
 {
 	const auto database = getTempFile("Blob-cancelDiscardsHandle.fdb");
@@ -0,0 +1,199 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/Attachment.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/BlobStream.h"
+#include "fb-cpp/Transaction.h"
+#include <iterator>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(BlobStreamSuite)
+
+BOOST_AUTO_TEST_CASE(streamRoundTrip)
+{
+	const auto database = getTempFile("BlobStream-streamRoundTrip.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	std::ostringstream expected;
+
+	for (int i = 0; i < 20000; ++i)
+		expected << "line " << i << '\n';
+
+	BlobId blobId;
+
+	{  // scope
+		Blob writer{attachment, transaction};
+
+		{  // scope
+			BlobOutputStream output{writer, 1000};
+			output << expected.str();
+			BOOST_CHECK(output.flush().good());
+		}
+
+		writer.close();
+		blobId = writer.getId();
+	}
+
+	Blob reader{attachment, transaction, blobId};
+	BlobInputStream input{reader, 1000};
+
+	std::string line;
+	int count = 0;
+
+	while (std::getline(input, line))
+		BOOST_CHECK_EQUAL(line, "line " + std::to_string(count++));
+
+	BOOST_CHECK_EQUAL(count, 20000);
+}
+
+BOOST_AUTO_TEST_CASE(streamSeek)
+{
+	const auto database = getTempFile("BlobStream-streamSeek.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	const auto streamOptions = BlobOptions().setType(BlobType::STREAM);
+	const std::string text = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+	Blob writer{attachment, transaction, streamOptions};
+	writer.write(std::as_bytes(std::span{text}));
+	writer.close();
+
+	Blob reader{attachment, transaction, writer.getId(), streamOptions};
+	BlobInputStream input{reader, 8};
+
+	input.seekg(10);
+	BOOST_CHECK_EQUAL(static_cast<char>(input.get()), 'a');
+	BOOST_CHECK_EQUAL(static_cast<std::streamoff>(input.tellg()), 11);
+
+	input.seekg(-3, std::ios_base::end);
+	std::string tail;
+	input >> tail;
+	BOOST_CHECK_EQUAL(tail, "xyz");
+
+	input.clear();
+	input.seekg(0);
+	std::string all{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+	BOOST_CHECK_EQUAL(all, text);
+}
+
+BOOST_AUTO_TEST_CASE(readAll)
+{
+	const auto database = getTempFile("BlobStream-readAll.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	std::string text(200000, '\0');
+
+	for (std::size_t i = 0; i < text.size(); ++i)
+		text[i] = static_cast<char>('a' + (i % 26));
+
+	Blob writer{attachment, transaction};
+	writer.write(std::as_bytes(std::span{text}));
+	writer.close();
+
+	{  // scope
+		Blob reader{attachment, transaction, writer.getId()};
+		std::string result = "prefix";
+		reader.readAll(result);
+		BOOST_CHECK(result == "prefix" + text);
+	}
+
+	{  // scope
+		Blob reader{attachment, transaction, writer.getId()};
+		const auto bytes = reader.readAll();
+		BOOST_REQUIRE_EQUAL(bytes.size(), text.size());
+		BOOST_CHECK(std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size()) == text);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(pipelinedWriter)
+{
+	const auto database = getTempFile("BlobStream-pipelinedWriter.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	std::string expected;
+	Blob writer{attachment, transaction};
+
+	{  // scope
+		BlobWriter pipelined{writer, 100000};
+
+		for (int i = 0; i < 1000; ++i)
+		{
+			const auto chunk = std::string(997, static_cast<char>('A' + (i % 26)));
+			pipelined.write(std::span{chunk});
+			expected += chunk;
+		}
+
+		pipelined.finish();
+		BOOST_CHECK_EQUAL(pipelined.getBytesWritten(), expected.size());
+	}
+
+	writer.close();
+
+	Blob reader{attachment, transaction, writer.getId()};
+	std::string result;
+	reader.readAll(result);
+	BOOST_CHECK(result == expected);
+}
+
+BOOST_AUTO_TEST_CASE(invalidArguments)
+{
+	const auto database = getTempFile("BlobStream-invalidArguments.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	Blob blob{attachment, transaction};
+
+	BOOST_CHECK_THROW(BlobStreamBuffer(blob, std::ios_base::in | std::ios_base::out), std::invalid_argument);
+	BOOST_CHECK_THROW(BlobStreamBuffer(blob, std::ios_base::out, 0), std::invalid_argument);
+	BOOST_CHECK_THROW(BlobWriter(blob, 0), std::invalid_argument);
+
+	blob.cancel();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
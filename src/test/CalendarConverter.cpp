@@ -29,6 +29,8 @@
 #include <array>
 #include <chrono>
 #include <optional>
+#include <span>
+#include <stdexcept>
 #include <ostream>
 #include <string_view>
 #include <boost/test/data/test_case.hpp>
@@ -295,4 +297,57 @@ BOOST_DATA_TEST_CASE(timestampTzOffsetConversion, data::make(TIMESTAMP_TZ_OFFSET
 }
 
 
+BOOST_AUTO_TEST_CASE(encodingMatchesUtil)
+{
+	const auto util = CLIENT.getUtil();
+
+	for (const auto& date : {Date{1y / month{1} / 1d}, Date{1858y / month{11} / 17d}, Date{1900y / month{2} / 28d},
+			 Date{2000y / month{2} / 29d}, Date{2024y / month{12} / 31d}, Date{9999y / month{12} / 31d}})
+	{
+		const auto encoded = impl::CalendarConverter::encodeDate(date);
+		BOOST_CHECK_EQUAL(encoded,
+			util->encodeDate(static_cast<unsigned>(static_cast<int>(date.year())),
+				static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day())));
+		BOOST_CHECK_EQUAL(impl::CalendarConverter::decodeDate(encoded), date);
+	}
+
+	for (const auto& time : {Time{0us}, Time{13h + 14min + 15s + 123400us}, Time{23h + 59min + 59s + 999900us}})
+	{
+		const auto encoded = impl::CalendarConverter::encodeTime(time);
+		BOOST_CHECK_EQUAL(encoded,
+			util->encodeTime(static_cast<unsigned>(time.hours().count()), static_cast<unsigned>(time.minutes().count()),
+				static_cast<unsigned>(time.seconds().count()), static_cast<unsigned>(time.subseconds().count() / 100)));
+		BOOST_CHECK_EQUAL(impl::CalendarConverter::decodeTime(encoded).to_duration(), time.to_duration());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(batchConversion)
+{
+	const auto status = CLIENT.newStatus();
+	impl::StatusWrapper statusWrapper{CLIENT, status.get()};
+
+	impl::CalendarConverter converter{CLIENT, &statusWrapper};
+
+	const std::array dates{Date{2024y / month{2} / 29d}, Date{1y / month{1} / 1d}, Date{9999y / month{12} / 31d}};
+	std::array<OpaqueDate, 3> opaqueDates;
+	std::array<Date, 3> decodedDates;
+
+	converter.datesToOpaqueDates(dates, opaqueDates);
+	converter.opaqueDatesToDates(opaqueDates, decodedDates);
+	BOOST_CHECK(decodedDates == dates);
+
+	const std::array timestamps{Timestamp{dates[0], Time{13h + 14min + 15s + 123400us}},
+		Timestamp{dates[1], Time{0us}}, Timestamp{dates[2], Time{23h + 59min + 59s + 999900us}}};
+	std::array<OpaqueTimestamp, 3> opaqueTimestamps;
+	std::array<Timestamp, 3> decodedTimestamps;
+
+	converter.timestampsToOpaqueTimestamps(timestamps, opaqueTimestamps);
+	converter.opaqueTimestampsToTimestamps(opaqueTimestamps, decodedTimestamps);
+	BOOST_CHECK(decodedTimestamps == timestamps);
+
+	BOOST_CHECK_THROW(
+		converter.opaqueDatesToDates(opaqueDates, std::span{decodedDates}.first(2)), std::invalid_argument);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
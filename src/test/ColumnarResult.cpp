@@ -0,0 +1,116 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ColumnarResult.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <numeric>
+#include <string>
+
+
+BOOST_AUTO_TEST_SUITE(ColumnarResultSuite)
+
+BOOST_AUTO_TEST_CASE(drainMaterializesColumns)
+{
+	const auto database = getTempFile("ColumnarResult-drainMaterializesColumns.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer, amount double precision, name varchar(10))"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (id, amount, name) values (?, ?, ?)"};
+	for (int i = 1; i <= 20; ++i)
+	{
+		insert.setInt32(0, i);
+		insert.setDouble(1, i % 3 == 0 ? std::nullopt : std::optional<double>{i * 1.5});
+		insert.setString(2, "n" + std::to_string(i));
+		insert.execute(transaction);
+	}
+
+	Statement select{attachment, transaction, "select id, amount, name from t order by id",
+		StatementOptions().setFetchBufferRows(8)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	ColumnarResult result{select};
+	BOOST_CHECK_EQUAL(result.drain(select), 20u);
+	BOOST_CHECK_EQUAL(result.getRowCount(), 20u);
+	BOOST_REQUIRE_EQUAL(result.getColumnCount(), 3u);
+
+	const auto ids = result.getColumn(0).getValues<std::int32_t>();
+	BOOST_REQUIRE_EQUAL(ids.size(), 20u);
+	BOOST_CHECK_EQUAL(std::accumulate(ids.begin(), ids.end(), 0), 210);
+	BOOST_CHECK_EQUAL(result.getColumn(0).getNullCount(), 0u);
+
+	const auto& amount = result.getColumn(1);
+	const auto amounts = amount.getValues<double>();
+	BOOST_CHECK_EQUAL(amount.getNullCount(), 6u);
+	BOOST_CHECK(amount.isNull(2));
+	BOOST_CHECK(!amount.isNull(3));
+	BOOST_CHECK_EQUAL(amounts[2], 0.0);
+	BOOST_CHECK_EQUAL(amounts[3], 6.0);
+	BOOST_CHECK_EQUAL(amount.getValidity().size(), 3u);
+
+	const auto& name = result.getColumn(2);
+	BOOST_CHECK(name.isString());
+	BOOST_CHECK_EQUAL(name.getString(0), "n1");
+	BOOST_CHECK_EQUAL(name.getString(19), "n20");
+	BOOST_CHECK_EQUAL(name.getOffsets().size(), 21u);
+
+	BOOST_CHECK_THROW(result.getColumn(0).getValues<double>(), FbCppException);
+	BOOST_CHECK_THROW(name.getValues<std::int32_t>(), FbCppException);
+	BOOST_CHECK_THROW(result.getColumn(3), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(drainHonorsMaxRows)
+{
+	const auto database = getTempFile("ColumnarResult-drainHonorsMaxRows.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select rdb$relation_id from rdb$relations where rdb$relation_id < 10 order by rdb$relation_id",
+		StatementOptions().setFetchBufferRows(4)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	ColumnarResult result{select};
+	BOOST_CHECK_EQUAL(result.drain(select, 3), 3u);
+	BOOST_CHECK_EQUAL(result.getColumn(0).getValues<std::int16_t>()[0], 0);
+
+	result.clear();
+	BOOST_CHECK_EQUAL(result.getRowCount(), 0u);
+	BOOST_CHECK_EQUAL(result.drain(select), 7u);
+	BOOST_CHECK_EQUAL(result.getColumn(0).getValues<std::int16_t>()[0], 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ConnectionPool.h"
+#include "fb-cpp/Exception.h"
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+
+BOOST_AUTO_TEST_SUITE(ConnectionPoolSuite)
+
+BOOST_AUTO_TEST_CASE(warmupOpensConnections)
+{
+	const auto database = getTempFile("ConnectionPool-warmupOpensConnections.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database, ConnectionPoolOptions().setWarmup(3)};
+
+	const auto stats = pool.getStats();
+	BOOST_CHECK_EQUAL(stats.created, 3u);
+	BOOST_CHECK_EQUAL(stats.idle, 3u);
+	BOOST_CHECK_EQUAL(stats.leased, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(acquireReusesIdleConnections)
+{
+	const auto database = getTempFile("ConnectionPool-acquireReusesIdleConnections.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database};
+
+	Attachment* first = nullptr;
+
+	{  // scope
+		auto lease = pool.acquire();
+		BOOST_CHECK(lease->isValid());
+		first = &lease.get();
+		BOOST_CHECK_EQUAL(pool.getStats().leased, 1u);
+	}
+
+	{  // scope
+		auto lease = pool.acquire();
+		BOOST_CHECK(&lease.get() == first);
+	}
+
+	const auto stats = pool.getStats();
+	BOOST_CHECK_EQUAL(stats.created, 1u);
+	BOOST_CHECK_EQUAL(stats.acquired, 2u);
+	BOOST_CHECK_EQUAL(stats.idle, 1u);
+	BOOST_CHECK_EQUAL(std::accumulate(stats.waitHistogram.begin(), stats.waitHistogram.end(), std::uint64_t{0}), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(invalidatedConnectionsAreClosed)
+{
+	const auto database = getTempFile("ConnectionPool-invalidatedConnectionsAreClosed.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database};
+
+	{  // scope
+		auto lease = pool.acquire();
+		lease.invalidate();
+	}
+
+	const auto stats = pool.getStats();
+	BOOST_CHECK_EQUAL(stats.destroyed, 1u);
+	BOOST_CHECK_EQUAL(stats.idle, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(acquireTimesOutWhenExhausted)
+{
+	const auto database = getTempFile("ConnectionPool-acquireTimesOutWhenExhausted.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database, ConnectionPoolOptions().setMaxIdle(1).setMaxSize(1)};
+
+	auto lease = pool.acquire();
+	BOOST_CHECK_THROW(pool.acquire(50ms), FbCppException);
+	BOOST_CHECK_EQUAL(pool.getStats().timeouts, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(acquireWaitsForReleasedConnection)
+{
+	const auto database = getTempFile("ConnectionPool-acquireWaitsForReleasedConnection.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database, ConnectionPoolOptions().setMaxIdle(2).setMaxSize(2)};
+
+	std::vector<std::thread> threads;
+
+	for (int i = 0; i < 8; ++i)
+	{
+		threads.emplace_back(
+			[&pool]
+			{
+				for (int j = 0; j < 5; ++j)
+				{
+					auto lease = pool.acquire(10s);
+					lease->ping();
+				}
+			});
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	const auto stats = pool.getStats();
+	BOOST_CHECK_EQUAL(stats.acquired, 40u);
+	BOOST_CHECK_LE(stats.created, 2u);
+	BOOST_CHECK_EQUAL(stats.leased, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(reaperClosesIdleConnections)
+{
+	const auto database = getTempFile("ConnectionPool-reaperClosesIdleConnections.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database,
+		ConnectionPoolOptions().setWarmup(3).setMinIdle(1).setIdleTimeout(10ms).setReaperInterval(20ms)};
+
+	const auto deadline = std::chrono::steady_clock::now() + 5s;
+
+	while (pool.getStats().idle > 1u && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(10ms);
+
+	const auto stats = pool.getStats();
+	BOOST_CHECK_EQUAL(stats.idle, 1u);
+	BOOST_CHECK_EQUAL(stats.destroyed, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(invalidOptionsAreRejected)
+{
+	const auto database = getTempFile("ConnectionPool-invalidOptionsAreRejected.fdb");
+
+	BOOST_CHECK_THROW(ConnectionPool(CLIENT, database, ConnectionPoolOptions().setMaxSize(0)), std::invalid_argument);
+	BOOST_CHECK_THROW(
+		ConnectionPool(CLIENT, database, ConnectionPoolOptions().setMinIdle(4).setMaxIdle(2)), std::invalid_argument);
+	BOOST_CHECK_THROW(ConnectionPool(CLIENT, database,
+						  ConnectionPoolOptions().setAttachmentOptions(AttachmentOptions().setCreateDatabase(true))),
+		std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
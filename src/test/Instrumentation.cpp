@@ -0,0 +1,134 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/Instrumentation.h"
+#include "fb-cpp/Blob.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <span>
+#include <string_view>
+
+
+BOOST_AUTO_TEST_SUITE(InstrumentationSuite)
+
+BOOST_AUTO_TEST_CASE(countsStatementAndTransactionCalls)
+{
+	const auto database = getTempFile("Instrumentation-countsStatementAndTransactionCalls.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	BOOST_CHECK(attachment.getInstrumentation() == nullptr);
+
+	InstrumentationCounters counters;
+	attachment.setInstrumentation(&counters);
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select r.rdb$relation_id from rdb$relations r where r.rdb$relation_id < 5 order by 1"};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	unsigned rows = 1;
+
+	while (select.fetchNext())
+		++rows;
+
+	select.free();
+	transaction.commitRetaining();
+	transaction.commit();
+
+	if constexpr (FB_CPP_USE_INSTRUMENTATION)
+	{
+		const auto prepare = counters.getStatementTotals(StatementOperation::PREPARE);
+		BOOST_CHECK_EQUAL(prepare.calls, 1u);
+
+		const auto execute = counters.getStatementTotals(StatementOperation::EXECUTE);
+		BOOST_CHECK_EQUAL(execute.calls, 1u);
+		BOOST_CHECK_EQUAL(execute.rows, 1u);
+		BOOST_CHECK(execute.messageBytes > 0u);
+
+		// The last fetch call finds no row.
+		const auto fetch = counters.getStatementTotals(StatementOperation::FETCH);
+		BOOST_CHECK_EQUAL(fetch.calls, rows);
+		BOOST_CHECK_EQUAL(fetch.rows, rows - 1);
+
+		BOOST_CHECK_EQUAL(counters.getTransactionTotals(TransactionOperation::START).calls, 1u);
+		BOOST_CHECK_EQUAL(counters.getTransactionTotals(TransactionOperation::COMMIT_RETAINING).calls, 1u);
+		BOOST_CHECK_EQUAL(counters.getTransactionTotals(TransactionOperation::COMMIT).calls, 1u);
+		BOOST_CHECK_EQUAL(counters.getTransactionTotals(TransactionOperation::ROLLBACK).calls, 0u);
+	}
+	else
+		BOOST_CHECK_EQUAL(counters.getStatementTotals(StatementOperation::PREPARE).calls, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(countsBlobBytes)
+{
+	const auto database = getTempFile("Instrumentation-countsBlobBytes.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	InstrumentationCounters counters;
+	attachment.setInstrumentation(&counters);
+
+	Transaction transaction{attachment};
+	constexpr std::string_view text = "instrumented blob content";
+
+	Blob writer{attachment, transaction};
+	writer.write(std::span{text});
+	writer.close();
+
+	Blob reader{attachment, transaction, writer.getId()};
+	const auto content = reader.readAll();
+	reader.close();
+
+	BOOST_CHECK_EQUAL(content.size(), text.size());
+
+	if constexpr (FB_CPP_USE_INSTRUMENTATION)
+	{
+		BOOST_CHECK_EQUAL(counters.getBlobBytes(BlobTransfer::WRITE), text.size());
+		BOOST_CHECK_EQUAL(counters.getBlobBytes(BlobTransfer::READ), text.size());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(attachmentInheritsClientInstrumentation)
+{
+	const auto database = getTempFile("Instrumentation-attachmentInheritsClientInstrumentation.fdb");
+
+	InstrumentationCounters counters;
+
+	// A local client, so the shared CLIENT never points to the counters of this test.
+	Client client{CLIENT.getMaster()};
+	client.setInstrumentation(&counters);
+
+	Attachment attachment{client, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	BOOST_CHECK(attachment.getInstrumentation() == &counters);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
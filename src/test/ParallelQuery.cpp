@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ParallelQuery.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Transaction.h"
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+	void createNumbers(Attachment& attachment, int count)
+	{
+		Transaction transaction{attachment};
+
+		Statement ddl{attachment, transaction, "create table numbers (n integer not null)"};
+		ddl.execute(transaction);
+		transaction.commitRetaining();
+
+		Statement insert{attachment, transaction,
+			"execute block (count integer = ?) as declare i integer = 1; "
+			"begin while (i <= count) do begin insert into numbers values (:i); i = i + 1; end end"};
+		insert.setInt32(0, count);
+		insert.execute(transaction);
+
+		transaction.commit();
+	}
+}  // namespace
+
+
+BOOST_AUTO_TEST_SUITE(ParallelQuerySuite)
+
+BOOST_AUTO_TEST_CASE(runsAllPartitions)
+{
+	const auto database = getTempFile("ParallelQuery-runsAllPartitions.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	createNumbers(attachment, 10000);
+
+	ConnectionPool pool{CLIENT, database, ConnectionPoolOptions().setMaxSize(4).setMaxIdle(4)};
+	ParallelQuery query{pool, "select n from numbers where n between ? and ? order by n",
+		ParallelQueryOptions().setParallelism(4).setChunkRows(700).setQueueCapacity(2)};
+
+	std::vector<std::pair<std::int32_t, std::int32_t>> ranges;
+
+	for (std::int32_t start = 1; start <= 10000; start += 1000)
+		ranges.emplace_back(start, start + 999);
+
+	std::set<std::int32_t> seen;
+	std::vector<std::int32_t> lastByPartition(ranges.size(), 0);
+
+	const auto stats = query.run(ranges,
+		[&](std::size_t partition, ColumnarResult& chunk)
+		{
+			BOOST_REQUIRE(chunk.getRowCount() <= 700);
+
+			for (const auto n : chunk.getColumn(0).getValues<std::int32_t>())
+			{
+				BOOST_REQUIRE(n >= ranges[partition].first && n <= ranges[partition].second);
+				BOOST_REQUIRE(n > lastByPartition[partition]);
+				lastByPartition[partition] = n;
+				seen.insert(n);
+			}
+		});
+
+	BOOST_CHECK_EQUAL(stats.rowCount, 10000u);
+	BOOST_CHECK_EQUAL(stats.chunkCount, 20u);
+	BOOST_CHECK_EQUAL(stats.workerCount, 4u);
+	BOOST_CHECK(stats.sharedSnapshot);
+	BOOST_CHECK_EQUAL(seen.size(), 10000u);
+}
+
+BOOST_AUTO_TEST_CASE(emptyPartitions)
+{
+	const auto database = getTempFile("ParallelQuery-emptyPartitions.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	createNumbers(attachment, 10);
+
+	ConnectionPool pool{CLIENT, database};
+	ParallelQuery query{pool, "select n from numbers where n > ?"};
+
+	std::vector<std::tuple<std::int32_t>> partitions{{100}, {200}};
+	std::size_t calls = 0;
+
+	const auto stats = query.run(partitions, [&](std::size_t, ColumnarResult&) { ++calls; });
+
+	BOOST_CHECK_EQUAL(calls, 0u);
+	BOOST_CHECK_EQUAL(stats.rowCount, 0u);
+
+	BOOST_CHECK_EQUAL(query.run(0, {}, {}).rowCount, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(consumerErrorStopsWorkers)
+{
+	const auto database = getTempFile("ParallelQuery-consumerErrorStopsWorkers.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	createNumbers(attachment, 5000);
+
+	ConnectionPool pool{CLIENT, database, ConnectionPoolOptions().setMaxSize(2).setMaxIdle(2)};
+	ParallelQuery query{
+		pool, "select n from numbers where mod(n, ?) = ?", ParallelQueryOptions().setParallelism(2).setChunkRows(10)};
+
+	BOOST_CHECK_THROW(query.run(
+						  4,
+						  [](Statement& statement, std::size_t partition)
+						  {
+							  statement.setInt32(0, 4);
+							  statement.setInt32(1, static_cast<std::int32_t>(partition));
+						  },
+						  [](std::size_t, ColumnarResult&) { throw std::runtime_error{"consumer failed"}; }),
+		std::runtime_error);
+
+	// Leases and transactions were released.
+	BOOST_CHECK_EQUAL(pool.getStats().leased, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(workerErrorIsRethrown)
+{
+	const auto database = getTempFile("ParallelQuery-workerErrorIsRethrown.fdb");
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ConnectionPool pool{CLIENT, database};
+	ParallelQuery query{pool, "select * from missing_table where id = ?"};
+
+	BOOST_CHECK_THROW(query.run(2, [](Statement& statement, std::size_t) { statement.setInt32(0, 1); },
+						  [](std::size_t, ColumnarResult&) {}),
+		DatabaseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ResultPager.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Transaction.h"
+#include <stdexcept>
+
+
+namespace
+{
+	void createNumbers(Attachment& attachment, Transaction& transaction, int count)
+	{
+		Statement ddl{attachment, transaction, "create table numbers (n integer not null)"};
+		ddl.execute(transaction);
+		transaction.commitRetaining();
+
+		Statement insert{attachment, transaction,
+			"execute block (count integer = ?) as declare i integer = 1; "
+			"begin while (i <= count) do begin insert into numbers values (:i); i = i + 1; end end"};
+		insert.setInt32(0, count);
+		insert.execute(transaction);
+	}
+}  // namespace
+
+
+BOOST_AUTO_TEST_SUITE(ResultPagerSuite)
+
+BOOST_AUTO_TEST_CASE(pagesInAnyOrder)
+{
+	const auto database = getTempFile("ResultPager-pagesInAnyOrder.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	createNumbers(attachment, transaction, 95);
+
+	Statement select{attachment, transaction, "select n from numbers order by n",
+		StatementOptions().setCursorType(CursorType::SCROLLABLE)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	ResultPager pager{select, 10, 2};
+
+	const auto checkPage = [&](unsigned pageIndex, std::size_t expectedRows)
+	{
+		const auto rows = pager.getPage(pageIndex);
+		BOOST_REQUIRE_EQUAL(rows.size(), expectedRows);
+
+		for (std::size_t i = 0; i < rows.size(); ++i)
+		{
+			select.setCurrentRow(rows[i]);
+			BOOST_CHECK_EQUAL(select.getInt32(0).value(), static_cast<int>(pageIndex * 10 + i + 1));
+		}
+	};
+
+	checkPage(3, 10);
+	checkPage(0, 10);
+	checkPage(9, 5);
+	checkPage(3, 10);
+	checkPage(10, 0);
+	checkPage(5, 10);
+
+	BOOST_CHECK_EQUAL(pager.getRowCount(), 95u);
+	BOOST_CHECK_EQUAL(pager.getPageCount(), 10u);
+
+	pager.clear();
+	BOOST_CHECK_EQUAL(pager.getRowCount(), 95u);
+	checkPage(9, 5);
+}
+
+BOOST_AUTO_TEST_CASE(rowCount)
+{
+	const auto database = getTempFile("ResultPager-rowCount.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	createNumbers(attachment, transaction, 1000);
+
+	for (const int limit : {0, 1, 2, 3, 64, 513, 1000})
+	{
+		Statement select{attachment, transaction, "select n from numbers where n <= ?",
+			StatementOptions().setCursorType(CursorType::SCROLLABLE)};
+		select.setInt32(0, limit);
+		select.execute(transaction);
+
+		ResultPager pager{select, 100};
+		BOOST_CHECK_EQUAL(pager.getRowCount(), static_cast<unsigned>(limit));
+		BOOST_CHECK_EQUAL(pager.getPageCount(), static_cast<unsigned>((limit + 99) / 100));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(requiresScrollableCursor)
+{
+	const auto database = getTempFile("ResultPager-requiresScrollableCursor.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement forwardOnly{attachment, transaction, "select 1 from rdb$database"};
+	BOOST_CHECK_THROW(ResultPager(forwardOnly, 10), FbCppException);
+
+	Statement scrollable{attachment, transaction, "select 1 from rdb$database",
+		StatementOptions().setCursorType(CursorType::SCROLLABLE)};
+	BOOST_CHECK_THROW(ResultPager(scrollable, 0), std::invalid_argument);
+	BOOST_CHECK_THROW(ResultPager(scrollable, 10, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
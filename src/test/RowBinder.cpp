@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/RowBinder.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <tuple>
+
+using namespace std::chrono;
+
+
+BOOST_AUTO_TEST_SUITE(RowBinderSuite)
+
+BOOST_AUTO_TEST_CASE(bindsStructMatchingGet)
+{
+	const auto database = getTempFile("RowBinder-bindsStructMatchingGet.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	struct Row
+	{
+		std::int64_t id;
+		std::optional<std::string> name;
+		double amount;
+		std::optional<std::int32_t> missing;
+		Date day;
+		Timestamp moment;
+		std::string scaled;
+	};
+
+	Statement stmt{attachment, transaction,
+		"select cast(1 as smallint), cast('abc' as varchar(10)), cast(1.5 as float), cast(null as integer), "
+		"date '2024-02-29', timestamp '2024-02-29 13:14:15.1234', cast(12.34 as numeric(9,2)) "
+		"from rdb$database"};
+	BOOST_REQUIRE(stmt.execute(transaction));
+
+	RowBinder<Row> binder{stmt};
+	const auto row = binder.get();
+	const auto expected = stmt.get<Row>();
+
+	BOOST_CHECK_EQUAL(row.id, expected.id);
+	BOOST_CHECK(row.name == expected.name);
+	BOOST_CHECK_EQUAL(row.amount, expected.amount);
+	BOOST_CHECK(!row.missing.has_value());
+	BOOST_CHECK_EQUAL(row.day, expected.day);
+	BOOST_CHECK(row.moment == expected.moment);
+	BOOST_CHECK_EQUAL(row.scaled, "12.34");
+}
+
+BOOST_AUTO_TEST_CASE(readReusesDestination)
+{
+	const auto database = getTempFile("RowBinder-readReusesDestination.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement stmt{attachment, transaction,
+		"select n, cast('row ' || n as varchar(10)), iif(mod(n, 2) = 0, null, n) "
+		"from (select 1 n from rdb$database union all select 2 from rdb$database)"};
+
+	RowBinder<std::tuple<std::int32_t, std::string, std::optional<std::int64_t>>> binder{stmt};
+	std::tuple<std::int32_t, std::string, std::optional<std::int64_t>> row;
+
+	BOOST_REQUIRE(stmt.execute(transaction));
+	binder.read(row);
+	BOOST_CHECK_EQUAL(std::get<0>(row), 1);
+	BOOST_CHECK_EQUAL(std::get<1>(row), "row 1");
+	BOOST_CHECK(std::get<2>(row) == std::optional<std::int64_t>{1});
+
+	BOOST_REQUIRE(stmt.fetchNext());
+	binder.read(row);
+	BOOST_CHECK_EQUAL(std::get<0>(row), 2);
+	BOOST_CHECK_EQUAL(std::get<1>(row), "row 2");
+	BOOST_CHECK(!std::get<2>(row).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(validatesOnConstructionAndNulls)
+{
+	const auto database = getTempFile("RowBinder-validatesOnConstructionAndNulls.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement stmt{attachment, transaction, "select 1, cast(null as integer) from rdb$database"};
+
+	BOOST_CHECK_THROW((RowBinder<std::tuple<std::int32_t>>{stmt}), FbCppException);
+
+	RowBinder<std::tuple<std::int32_t, std::int32_t>> binder{stmt};
+	BOOST_REQUIRE(stmt.execute(transaction));
+	BOOST_CHECK_THROW(binder.get(), FbCppException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/RowRange.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <vector>
+
+
+BOOST_AUTO_TEST_SUITE(RowRangeSuite)
+
+static constexpr auto FIVE_ROWS_SQL = "select n, cast('row ' || n as varchar(10)) from "
+									  "(select 1 n from rdb$database union all select 2 from rdb$database union all "
+									  "select 3 from rdb$database union all select 4 from rdb$database union all "
+									  "select 5 from rdb$database) order by n";
+
+BOOST_AUTO_TEST_CASE(iteratesStructRows)
+{
+	const auto database = getTempFile("RowRange-iteratesStructRows.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	struct Row
+	{
+		std::int32_t id;
+		std::string name;
+	};
+
+	Statement stmt{attachment, transaction, FIVE_ROWS_SQL};
+
+	std::vector<std::int32_t> ids;
+
+	for (auto& row : stmt.rows<Row>(transaction))
+	{
+		BOOST_CHECK_EQUAL(row.name, "row " + std::to_string(row.id));
+		ids.push_back(row.id);
+	}
+
+	BOOST_CHECK((ids == std::vector<std::int32_t>{1, 2, 3, 4, 5}));
+}
+
+BOOST_AUTO_TEST_CASE(composesWithRangesAndFetchBuffer)
+{
+	const auto database = getTempFile("RowRange-composesWithRangesAndFetchBuffer.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement stmt{attachment, transaction, FIVE_ROWS_SQL, StatementOptions().setFetchBufferRows(2)};
+
+	auto rows = stmt.rows<std::tuple<std::int64_t, std::optional<std::string>>>(transaction);
+	std::vector<std::int64_t> odd;
+
+	for (const auto& row : rows | std::views::filter([](const auto& row) { return std::get<0>(row) % 2 != 0; }))
+		odd.push_back(std::get<0>(row));
+
+	BOOST_CHECK((odd == std::vector<std::int64_t>{1, 3, 5}));
+	BOOST_CHECK_THROW(rows.begin(), FbCppException);
+}
+
+BOOST_AUTO_TEST_CASE(iteratesSingleColumnAndEmptyResults)
+{
+	const auto database = getTempFile("RowRange-iteratesSingleColumnAndEmptyResults.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement sum{attachment, transaction, "select n from (select 1 n from rdb$database union all "
+										   "select 2 from rdb$database)"};
+	std::int32_t total = 0;
+
+	for (const auto value : sum.rows<std::int32_t>(transaction))
+		total += value;
+
+	BOOST_CHECK_EQUAL(total, 3);
+
+	Statement empty{attachment, transaction, "select 1 from rdb$database where 1 = 0"};
+	BOOST_CHECK_EQUAL(std::ranges::distance(empty.rows<std::int32_t>(transaction)), 0);
+
+	BOOST_CHECK_THROW((sum.rows<std::tuple<std::int32_t, std::int32_t>>(transaction)), FbCppException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
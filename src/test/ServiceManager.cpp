@@ -0,0 +1,194 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/ServiceManager.h"
+#include "fb-cpp/Exception.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/Transaction.h"
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+
+namespace
+{
+	ServiceManagerOptions getServiceManagerOptions()
+	{
+		ServiceManagerOptions options;
+
+		if (!getTestServer().empty())
+			options.setServer(getTestServer());
+
+		return options;
+	}
+
+	void createNumbers(Attachment& attachment, int count)
+	{
+		Transaction transaction{attachment};
+
+		Statement ddl{attachment, transaction, "create table numbers (n integer not null primary key)"};
+		ddl.execute(transaction);
+		transaction.commitRetaining();
+
+		Statement insert{attachment, transaction,
+			"execute block (count integer = ?) as declare i integer = 1; "
+			"begin while (i <= count) do begin insert into numbers values (:i); i = i + 1; end end"};
+		insert.setInt32(0, count);
+		insert.execute(transaction);
+		transaction.commit();
+	}
+}  // namespace
+
+
+BOOST_AUTO_TEST_SUITE(ServiceManagerSuite)
+
+BOOST_AUTO_TEST_CASE(backupAndRestore)
+{
+	const auto database = getTempFile("ServiceManager-backupAndRestore.fdb");
+	const auto databasePath = getTempPath("ServiceManager-backupAndRestore.fdb");
+	const auto backupPath = getTempPath("ServiceManager-backupAndRestore.fbk");
+	const auto restoredPath = getTempPath("ServiceManager-backupAndRestore-restored.fdb");
+
+	{
+		Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+		FbDropDatabase attachmentDrop{attachment};
+		createNumbers(attachment, 100);
+
+		ServiceManager serviceManager{CLIENT, getServiceManagerOptions()};
+		std::string output;
+
+		serviceManager.backup(BackupOptions().setDatabase(databasePath).setBackupFile(backupPath).setVerbose(true),
+			[&](std::string_view text) { output += text; });
+
+		BOOST_CHECK(output.find("NUMBERS") != std::string::npos);
+
+		serviceManager.restore(RestoreOptions().setBackupFile(backupPath).setDatabase(restoredPath));
+	}
+
+	Attachment restored{CLIENT, getTempFile("ServiceManager-backupAndRestore-restored.fdb")};
+	FbDropDatabase restoredDrop{restored};
+
+	Transaction transaction{restored};
+	Statement select{restored, transaction, "select count(*) from numbers"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt64(0).value(), 100);
+
+	std::error_code ec;
+	std::filesystem::remove(backupPath, ec);
+}
+
+BOOST_AUTO_TEST_CASE(backupToAndRestoreFrom)
+{
+	const auto database = getTempFile("ServiceManager-backupToAndRestoreFrom.fdb");
+	const auto databasePath = getTempPath("ServiceManager-backupToAndRestoreFrom.fdb");
+	const auto restoredPath = getTempPath("ServiceManager-backupToAndRestoreFrom-restored.fdb");
+
+	{
+		Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+		FbDropDatabase attachmentDrop{attachment};
+		createNumbers(attachment, 100);
+
+		ServiceManager serviceManager{CLIENT, getServiceManagerOptions()};
+		std::vector<std::byte> backup;
+
+		const auto backupStatistics = serviceManager.backupTo(BackupOptions().setDatabase(databasePath),
+			[&](std::span<const std::byte> data) { backup.insert(backup.end(), data.begin(), data.end()); });
+
+		BOOST_CHECK_GT(backup.size(), 0u);
+		BOOST_CHECK_EQUAL(backupStatistics.bytes, backup.size());
+
+		std::size_t position = 0;
+
+		const auto restoreStatistics = serviceManager.restoreFrom(RestoreOptions().setDatabase(restoredPath),
+			[&](std::span<std::byte> buffer)
+			{
+				const auto length = std::min(buffer.size(), backup.size() - position);
+				std::copy_n(backup.begin() + position, length, buffer.begin());
+				position += length;
+				return length;
+			});
+
+		BOOST_CHECK_EQUAL(position, backup.size());
+		BOOST_CHECK_EQUAL(restoreStatistics.bytes, backup.size());
+	}
+
+	Attachment restored{CLIENT, getTempFile("ServiceManager-backupToAndRestoreFrom-restored.fdb")};
+	FbDropDatabase restoredDrop{restored};
+
+	Transaction transaction{restored};
+	Statement select{restored, transaction, "select count(*) from numbers"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt64(0).value(), 100);
+}
+
+BOOST_AUTO_TEST_CASE(restoreFailsOnExistingDatabase)
+{
+	const auto database = getTempFile("ServiceManager-restoreFailsOnExistingDatabase.fdb");
+	const auto databasePath = getTempPath("ServiceManager-restoreFailsOnExistingDatabase.fdb");
+	const auto backupPath = getTempPath("ServiceManager-restoreFailsOnExistingDatabase.fbk");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	ServiceManager serviceManager{CLIENT, getServiceManagerOptions()};
+	serviceManager.backup(BackupOptions().setDatabase(databasePath).setBackupFile(backupPath));
+
+	BOOST_CHECK_THROW(serviceManager.restore(RestoreOptions().setBackupFile(backupPath).setDatabase(databasePath)),
+		DatabaseException);
+
+	std::error_code ec;
+	std::filesystem::remove(backupPath, ec);
+}
+
+BOOST_AUTO_TEST_CASE(sweepValidateAndStatistics)
+{
+	const auto database = getTempFile("ServiceManager-sweepValidateAndStatistics.fdb");
+	const auto databasePath = getTempPath("ServiceManager-sweepValidateAndStatistics.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+	createNumbers(attachment, 100);
+
+	ServiceManager serviceManager{CLIENT, getServiceManagerOptions()};
+	serviceManager.sweep(databasePath);
+
+	std::string validation;
+	serviceManager.validate(databasePath, [&](std::string_view text) { validation += text; });
+	BOOST_CHECK(validation.find("Validation finished") != std::string::npos);
+
+	std::string statistics;
+	serviceManager.getStatistics(databasePath, [&](std::string_view text) { statistics += text; });
+	BOOST_CHECK(statistics.find("NUMBERS") != std::string::npos);
+
+	serviceManager.disconnect();
+	BOOST_CHECK(!serviceManager.isValid());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
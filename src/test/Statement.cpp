@@ -30,6 +30,9 @@
 #include <chrono>
 #include <cmath>
 #include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
 
 
 BOOST_AUTO_TEST_SUITE(StatementLifecycleSuite)
@@ -1023,6 +1026,54 @@ BOOST_AUTO_TEST_CASE(stringTruncationThrows)
 	BOOST_CHECK_THROW(stmt.setString(0, "This is too long"), DatabaseException);
 }
 
+BOOST_AUTO_TEST_CASE(getStringViewFromVarchar)
+{
+	const auto database = getTempFile("Statement-getStringViewFromVarchar.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement stmt{attachment, transaction,
+		"select cast('Test String' as varchar(50)), cast(null as varchar(10)), 1 from rdb$database"};
+	BOOST_REQUIRE(stmt.execute(transaction));
+	BOOST_CHECK_EQUAL(stmt.getStringView(0).value(), "Test String");
+	BOOST_CHECK_EQUAL(stmt.get<std::optional<std::string_view>>(0).value(), "Test String");
+	BOOST_CHECK(!stmt.getStringView(1).has_value());
+	BOOST_CHECK_THROW(stmt.getStringView(2), FbCppException);
+}
+
+BOOST_AUTO_TEST_CASE(getStringToAppends)
+{
+	const auto database = getTempFile("Statement-getStringToAppends.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true).setConnectionCharSet("UTF8")};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement stmt{attachment, transaction,
+		"select cast('abc' as varchar(10)), cast(456.78 as numeric(18,2)), cast(1.5 as double precision), "
+		"date '2024-02-29', timestamp '2024-02-29 13:14:15.1234', cast(null as integer) from rdb$database"};
+	BOOST_REQUIRE(stmt.execute(transaction));
+
+	std::string line;
+
+	for (unsigned i = 0; i < 6; ++i)
+	{
+		if (i != 0)
+			line += ';';
+
+		if (!stmt.getStringTo(i, line))
+			line += "NULL";
+
+		BOOST_CHECK(line.ends_with(stmt.getString(i).value_or("NULL")));
+	}
+
+	BOOST_CHECK_EQUAL(line, "abc;456.78;1.500000;2024-02-29;2024-02-29 13:14:15.1234;NULL");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -1380,6 +1431,72 @@ BOOST_AUTO_TEST_CASE(getBlobIdFromBlob)
 	BOOST_CHECK_EQUAL(readData, testData);
 }
 
+BOOST_AUTO_TEST_CASE(getStringAndBytesFromBlobWithInlineThreshold)
+{
+	const auto database = getTempFile("Statement-getStringAndBytesFromBlobWithInlineThreshold.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const std::string largeText(100000, 'x');
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "create table blob_test (id integer, data blob sub_type text)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement insert{attachment, transaction, "insert into blob_test (id, data) values (?, ?)"};
+
+		for (int i = 1; i <= 3; ++i)
+		{
+			Blob writer{attachment, transaction};
+			const auto text = i == 3 ? largeText : "text " + std::to_string(i);
+			writer.write(std::span{text});
+			writer.close();
+
+			insert.setInt32(0, i);
+			insert.setBlobId(1, writer.getId());
+			insert.execute(transaction);
+		}
+
+		insert.setInt32(0, 4);
+		insert.setNull(1);
+		insert.execute(transaction);
+
+		transaction.commit();
+	}
+
+	Transaction transaction{attachment};
+
+	{  // scope
+		Statement select{attachment, transaction, "select data from blob_test order by id"};
+		BOOST_REQUIRE(select.execute(transaction));
+		BOOST_CHECK_THROW(select.getString(0), FbCppException);
+	}
+
+	Statement select{attachment, transaction, "select data from blob_test order by id",
+		StatementOptions().setInlineBlobThreshold(1024)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	BOOST_CHECK_EQUAL(select.getString(0).value(), "text 1");
+	BOOST_REQUIRE(select.fetchNext());
+
+	const auto bytes = select.getBytes(0);
+	BOOST_REQUIRE(bytes.has_value());
+	BOOST_CHECK_EQUAL(std::string(reinterpret_cast<const char*>(bytes->data()), bytes->size()), "text 2");
+
+	BOOST_REQUIRE(select.fetchNext());
+	BOOST_CHECK(select.getString(0).value() == largeText);
+
+	BOOST_REQUIRE(select.fetchNext());
+	BOOST_CHECK(!select.getString(0).has_value());
+	BOOST_CHECK(!select.getBytes(0).has_value());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -1459,6 +1576,244 @@ BOOST_AUTO_TEST_CASE(cursorMethodsReturnFalseWithoutResultSet)
 	BOOST_CHECK_EQUAL(insert.fetchRelative(1), false);
 }
 
+BOOST_AUTO_TEST_CASE(fetchBlockReturnsBufferedRows)
+{
+	const auto database = getTempFile("Statement-fetchBlockReturnsBufferedRows.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (col integer, name varchar(10))"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (col, name) values (?, ?)"};
+	for (int i = 1; i <= 10; ++i)
+	{
+		insert.setInt32(0, i);
+		insert.setString(1, i % 2 == 0 ? std::optional<std::string>{std::to_string(i)} : std::nullopt);
+		insert.execute(transaction);
+	}
+
+	Statement select{attachment, transaction, "select col, name from t order by col",
+		StatementOptions().setFetchBufferRows(4)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	std::vector<std::size_t> blockSizes;
+	int expected = 1;
+
+	for (auto block = select.fetchBlock(); !block.empty(); block = select.fetchBlock())
+	{
+		blockSizes.push_back(block.size());
+
+		for (const auto row : block)
+		{
+			select.setCurrentRow(row);
+			BOOST_CHECK_EQUAL(select.getInt32(0).value(), expected);
+
+			if (expected % 2 == 0)
+				BOOST_CHECK_EQUAL(select.getString(1).value(), std::to_string(expected));
+			else
+				BOOST_CHECK(select.isNull(1));
+
+			++expected;
+		}
+	}
+
+	BOOST_CHECK_EQUAL(expected, 11);
+	BOOST_REQUIRE_EQUAL(blockSizes.size(), 3u);
+	BOOST_CHECK_EQUAL(blockSizes[0], 4u);
+	BOOST_CHECK_EQUAL(blockSizes[1], 4u);
+	BOOST_CHECK_EQUAL(blockSizes[2], 2u);
+}
+
+BOOST_AUTO_TEST_CASE(fetchBlockKeepsRowsOfBlockAlive)
+{
+	const auto database = getTempFile("Statement-fetchBlockKeepsRowsOfBlockAlive.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select 1 from rdb$database union all select 2 from rdb$database union all select 3 from rdb$database",
+		StatementOptions().setFetchBufferRows(8)};
+	BOOST_REQUIRE(select.execute(transaction));
+
+	const auto block = select.fetchBlock();
+	BOOST_REQUIRE_EQUAL(block.size(), 3u);
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 1);
+
+	select.setCurrentRow(block[2]);
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 3);
+
+	select.setCurrentRow(block[1]);
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 2);
+	BOOST_CHECK(select.getCurrentRow().getMessage() == block[1].getMessage());
+
+	BOOST_CHECK(select.fetchBlock().empty());
+}
+
+BOOST_AUTO_TEST_CASE(scrollableCursorMovesInAnyDirection)
+{
+	const auto database = getTempFile("Statement-scrollableCursorMovesInAnyDirection.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction,
+		"select 1 from rdb$database union all select 2 from rdb$database union all select 3 from rdb$database",
+		StatementOptions().setCursorType(CursorType::SCROLLABLE)};
+	BOOST_CHECK(select.getCursorType() == CursorType::SCROLLABLE);
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 1);
+
+	BOOST_REQUIRE(select.fetchLast());
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 3);
+
+	BOOST_REQUIRE(select.fetchPrior());
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 2);
+
+	BOOST_REQUIRE(select.fetchFirst());
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 1);
+
+	BOOST_REQUIRE(select.fetchRelative(2));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 3);
+
+	BOOST_REQUIRE(select.fetchAbsolute(2));
+	BOOST_CHECK_EQUAL(select.getInt32(0).value(), 2);
+
+	BOOST_CHECK(!select.fetchAbsolute(4));
+}
+
+BOOST_AUTO_TEST_CASE(forwardOnlyCursorRejectsScrolling)
+{
+	const auto database = getTempFile("Statement-forwardOnlyCursorRejectsScrolling.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement select{attachment, transaction, "select 1 from rdb$database"};
+	BOOST_CHECK(select.getCursorType() == CursorType::FORWARD_ONLY);
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_THROW(select.fetchLast(), DatabaseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE(StatementBatchSuite)
+
+BOOST_AUTO_TEST_CASE(executeBatchInsertsAllRows)
+{
+	const auto database = getTempFile("Statement-executeBatchInsertsAllRows.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer, name varchar(20))"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (id, name) values (?, ?)"};
+
+	for (int i = 1; i <= 100; ++i)
+	{
+		insert.setInt32(0, i);
+		insert.setString(1, "name" + std::to_string(i));
+		insert.addBatch();
+	}
+
+	const auto state = insert.executeBatch(transaction);
+	BOOST_CHECK_EQUAL(state.getSize(), 100u);
+	BOOST_CHECK(!state.hasErrors());
+	BOOST_CHECK_EQUAL(state.getState(0), 1);
+	BOOST_CHECK_EQUAL(state.getAffectedRows(), 100u);
+
+	Statement select{attachment, transaction, "select count(*), sum(id), max(name) from t"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt64(0).value(), 100);
+	BOOST_CHECK_EQUAL(select.getInt64(1).value(), 5050);
+	BOOST_CHECK_EQUAL(select.getString(2).value(), "name99");
+}
+
+BOOST_AUTO_TEST_CASE(executeBatchReportsRowErrors)
+{
+	const auto database = getTempFile("Statement-executeBatchReportsRowErrors.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer not null primary key)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (id) values (?)"};
+
+	for (const int id : {1, 2, 2, 3})
+	{
+		insert.setInt32(0, id);
+		insert.addBatch();
+	}
+
+	const auto state = insert.executeBatch(transaction);
+	BOOST_REQUIRE_EQUAL(state.getSize(), 4u);
+	BOOST_CHECK(state.hasErrors());
+	BOOST_CHECK_EQUAL(state.getState(0), 1);
+	BOOST_CHECK_EQUAL(state.getState(2), BatchCompletionState::EXECUTE_FAILED);
+	BOOST_CHECK_EQUAL(state.getState(3), 1);
+	BOOST_REQUIRE_EQUAL(state.getErrors().size(), 1u);
+	BOOST_CHECK_EQUAL(state.getErrors()[0].index, 2u);
+	BOOST_CHECK(!state.getErrors()[0].message.empty());
+	BOOST_CHECK_THROW(state.getState(4), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(batchCanBeReusedAndCanceled)
+{
+	const auto database = getTempFile("Statement-batchCanBeReusedAndCanceled.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (id) values (?)"};
+
+	BOOST_CHECK_EQUAL(insert.executeBatch(transaction).getSize(), 0u);
+
+	insert.setInt32(0, 1);
+	insert.addBatch();
+	BOOST_CHECK_EQUAL(insert.executeBatch(transaction).getSize(), 1u);
+
+	insert.setInt32(0, 2);
+	insert.addBatch();
+	insert.cancelBatch();
+
+	insert.setInt32(0, 3);
+	insert.addBatch();
+	BOOST_CHECK_EQUAL(insert.executeBatch(transaction).getSize(), 1u);
+
+	Statement select{attachment, transaction, "select count(*), sum(id) from t"};
+	BOOST_REQUIRE(select.execute(transaction));
+	BOOST_CHECK_EQUAL(select.getInt64(0).value(), 2);
+	BOOST_CHECK_EQUAL(select.getInt64(1).value(), 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -3307,4 +3662,37 @@ BOOST_AUTO_TEST_CASE(getVariantOpaqueTimestampTzPreferred)
 	BOOST_REQUIRE(std::holds_alternative<OpaqueTimestampTz>(result));
 }
 
+BOOST_AUTO_TEST_CASE(getRecordCounts)
+{
+	const auto database = getTempFile("Statement-getRecordCounts.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+
+	Statement ddl{attachment, transaction, "create table t (id integer not null primary key)"};
+	ddl.execute(transaction);
+	transaction.commitRetaining();
+
+	Statement insert{attachment, transaction, "insert into t (id) select rdb$relation_id + 1 from rdb$relations"};
+	insert.execute(transaction);
+
+	const auto inserted = insert.getRecordCounts().inserted;
+	BOOST_CHECK(inserted > 0u);
+	BOOST_CHECK_EQUAL(insert.getAffectedRows(), inserted);
+
+	Statement update{attachment, transaction, "update t set id = -id where id between 1 and 10"};
+	update.execute(transaction);
+
+	const auto counts = update.getRecordCounts();
+	BOOST_CHECK_EQUAL(counts.updated, 10u);
+	BOOST_CHECK_EQUAL(counts.inserted, 0u);
+	BOOST_CHECK_EQUAL(update.getAffectedRows(), 10u);
+
+	Statement remove{attachment, transaction, "delete from t where id < 0"};
+	remove.execute(transaction);
+	BOOST_CHECK_EQUAL(remove.getRecordCounts().deleted, 10u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 Adriano dos Santos Fernandes
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to do so, subject to the
+ * following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "fb-cpp/Statement.h"
+#include "fb-cpp/StatementCache.h"
+#include "fb-cpp/Transaction.h"
+
+
+BOOST_AUTO_TEST_SUITE(StatementCacheSuite)
+
+BOOST_AUTO_TEST_CASE(acquireReusesPreparedStatement)
+{
+	const auto database = getTempFile("StatementCache-acquireReusesPreparedStatement.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	StatementCache cache{attachment};
+
+	fb::IStatement* firstHandle = nullptr;
+
+	{  // scope
+		auto lease = cache.acquire(transaction, "select cast(? as integer) from rdb$database");
+		firstHandle = lease->getStatementHandle().get();
+
+		lease->setInt32(0, 10);
+		BOOST_REQUIRE(lease->execute(transaction));
+		BOOST_CHECK_EQUAL(lease->getInt32(0).value(), 10);
+	}
+
+	{  // scope
+		auto lease = cache.acquire(transaction, "select cast(? as integer) from rdb$database");
+		BOOST_CHECK(lease->getStatementHandle().get() == firstHandle);
+		BOOST_CHECK(!lease->getResultSetHandle());
+
+		// Parameters were reset to null when the statement was returned.
+		BOOST_REQUIRE(lease->execute(transaction));
+		BOOST_CHECK(lease->isNull(0));
+	}
+
+	const auto stats = cache.getStats();
+	BOOST_CHECK_EQUAL(stats.hits, 1u);
+	BOOST_CHECK_EQUAL(stats.misses, 1u);
+	BOOST_CHECK_EQUAL(stats.evictions, 0u);
+	BOOST_CHECK_EQUAL(stats.size, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(optionsArePartOfTheKey)
+{
+	const auto database = getTempFile("StatementCache-optionsArePartOfTheKey.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	StatementCache cache{attachment};
+
+	constexpr auto sql = "select 1 from rdb$database";
+
+	cache.acquire(transaction, sql);
+	cache.acquire(transaction, sql, StatementOptions().setPrefetchPlan(true));
+	cache.acquire(transaction, sql, StatementOptions().setPrefetchPlan(true));
+
+	const auto stats = cache.getStats();
+	BOOST_CHECK_EQUAL(stats.hits, 1u);
+	BOOST_CHECK_EQUAL(stats.misses, 2u);
+	BOOST_CHECK_EQUAL(stats.size, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(concurrentLeasesGetDistinctStatements)
+{
+	const auto database = getTempFile("StatementCache-concurrentLeasesGetDistinctStatements.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	StatementCache cache{attachment};
+
+	{  // scope
+		auto lease1 = cache.acquire(transaction, "select 1 from rdb$database");
+		auto lease2 = cache.acquire(transaction, "select 1 from rdb$database");
+		BOOST_CHECK(&lease1.get() != &lease2.get());
+	}
+
+	const auto stats = cache.getStats();
+	BOOST_CHECK_EQUAL(stats.misses, 2u);
+	BOOST_CHECK_EQUAL(stats.size, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(leastRecentlyUsedStatementsAreEvicted)
+{
+	const auto database = getTempFile("StatementCache-leastRecentlyUsedStatementsAreEvicted.fdb");
+
+	Attachment attachment{CLIENT, database, AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	Transaction transaction{attachment};
+	StatementCache cache{attachment, 2};
+
+	cache.acquire(transaction, "select 1 from rdb$database");
+	cache.acquire(transaction, "select 2 from rdb$database");
+	cache.acquire(transaction, "select 1 from rdb$database");
+	cache.acquire(transaction, "select 3 from rdb$database");
+
+	auto stats = cache.getStats();
+	BOOST_CHECK_EQUAL(stats.evictions, 1u);
+	BOOST_CHECK_EQUAL(stats.size, 2u);
+
+	// "select 2" was the least recently used one.
+	cache.acquire(transaction, "select 1 from rdb$database");
+	cache.acquire(transaction, "select 2 from rdb$database");
+
+	stats = cache.getStats();
+	BOOST_CHECK_EQUAL(stats.hits, 2u);
+	BOOST_CHECK_EQUAL(stats.misses, 4u);
+
+	cache.clear();
+	BOOST_CHECK_EQUAL(cache.getStats().size, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
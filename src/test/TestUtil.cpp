@@ -44,6 +44,7 @@ namespace fbcpp::test
 	{
 		fs::path tempDir;
 		bool removeTempDir = false;
+		std::string testServer;
 		std::string testServerPrefix;
 
 		bool createAccessibleDirectory(const fs::path& path)
@@ -64,7 +65,10 @@ namespace fbcpp::test
 				const char* testDirEnv = std::getenv("FBCPP_TEST_DIR");
 				const char* testServerEnv = std::getenv("FBCPP_TEST_SERVER");
 				if (testServerEnv && *testServerEnv)
-					testServerPrefix = std::string(testServerEnv) + ":";
+				{
+					testServer = testServerEnv;
+					testServerPrefix = testServer + ":";
+				}
 
 				if (testDirEnv && *testDirEnv)
 				{
@@ -102,7 +106,17 @@ namespace fbcpp::test
 
 	std::string getTempFile(const std::string_view name)
 	{
-		return testServerPrefix + (tempDir / name).string();
+		return testServerPrefix + getTempPath(name);
+	}
+
+	const std::string& getTestServer()
+	{
+		return testServer;
+	}
+
+	std::string getTempPath(const std::string_view name)
+	{
+		return (tempDir / name).string();
 	}
 }  // namespace fbcpp::test
 
@@ -39,6 +39,8 @@ namespace fbcpp::test
 	extern Client CLIENT;
 
 	std::string getTempFile(const std::string_view name);
+	std::string getTempPath(const std::string_view name);
+	const std::string& getTestServer();
 
 	class FbDropDatabase
 	{
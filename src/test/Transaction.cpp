@@ -23,6 +23,7 @@
  */
 
 #include "TestUtil.h"
+#include "fb-cpp/Statement.h"
 #include "fb-cpp/Transaction.h"
 #include "fb-cpp/Exception.h"
 #include <exception>
@@ -51,6 +52,31 @@ BOOST_AUTO_TEST_CASE(constructorWithOptions)
 	transaction2.rollback();
 }
 
+BOOST_AUTO_TEST_CASE(constructorWithCompiledOptions)
+{
+	Attachment attachment{CLIENT, getTempFile("Transaction-constructorWithCompiledOptions.fdb"),
+		AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	const CompiledTransactionOptions options{CLIENT,
+		TransactionOptions()
+			.setIsolationLevel(TransactionIsolationLevel::READ_COMMITTED)
+			.setReadCommittedMode(TransactionReadCommittedMode::RECORD_VERSION)
+			.setAccessMode(TransactionAccessMode::READ_ONLY)};
+	BOOST_CHECK(!options.getTpb().empty());
+
+	for (int i = 0; i < 3; ++i)
+	{
+		Transaction transaction{attachment, options};
+		BOOST_CHECK(transaction.isValid());
+
+		Statement insert{attachment, transaction, "create table t (n integer)"};
+		BOOST_CHECK_THROW(insert.execute(transaction), DatabaseException);
+
+		transaction.commit();
+	}
+}
+
 BOOST_AUTO_TEST_CASE(constructorWithSetTransactionCmd)
 {
 	Attachment attachment{CLIENT, getTempFile("Transaction-constructorWithSetTransactionCmd.fdb"),
@@ -140,4 +166,42 @@ BOOST_AUTO_TEST_CASE(isNotValidAfterMove)
 	BOOST_CHECK_EQUAL(transaction2.isValid(), false);
 }
 
+BOOST_AUTO_TEST_CASE(shareSnapshot)
+{
+	Attachment attachment{
+		CLIENT, getTempFile("Transaction-shareSnapshot.fdb"), AttachmentOptions().setCreateDatabase(true)};
+	FbDropDatabase attachmentDrop{attachment};
+
+	{  // scope
+		Transaction transaction{attachment};
+		Statement ddl{attachment, transaction, "create table t (n integer)"};
+		ddl.execute(transaction);
+		transaction.commit();
+	}
+
+	Transaction first{attachment, TransactionOptions().setIsolationLevel(TransactionIsolationLevel::SNAPSHOT)};
+	const auto snapshotNumber = first.getSnapshotNumber();
+	BOOST_CHECK(snapshotNumber != 0);
+
+	{  // scope
+		Transaction writer{attachment};
+		Statement insert{attachment, writer, "insert into t values (1)"};
+		insert.execute(writer);
+		writer.commit();
+	}
+
+	Transaction shared{attachment,
+		TransactionOptions()
+			.setIsolationLevel(TransactionIsolationLevel::SNAPSHOT)
+			.setAtSnapshotNumber(snapshotNumber)};
+	BOOST_CHECK_EQUAL(shared.getSnapshotNumber(), snapshotNumber);
+
+	Statement count{attachment, shared, "select count(*) from t"};
+	BOOST_REQUIRE(count.execute(shared));
+	BOOST_CHECK_EQUAL(count.getInt64(0).value(), 0);
+
+	shared.commit();
+	first.commit();
+}
+
 BOOST_AUTO_TEST_SUITE_END()